@@ -4,6 +4,8 @@
  *       (See accompanying file LICENSE or copy at
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
+#include <algorithm>
+
 #include <Rodin/Geometry.h>
 #include <Rodin/Alert.h>
 
@@ -18,23 +20,18 @@ int main(int, char**)
 
   Alert::Info() << "Performing CCL on mesh attributes..." << Alert::Raise;
 
-  // auto ccs = mesh.ccl(
-  //    [](const Element& el1, const Element& el2)
-  //    {
-  //     return el1.getAttribute() == el2.getAttribute();
-  //    });
-
-  // Alert::Info() << ccs.size() << " components found." << Alert::Raise;
-
-  // for (size_t i = 0; i < ccs.size(); i++)
-  // {
-  //  const auto& cc = ccs[i];
-  //  mesh.edit(
-  //     [&](ElementView element)
-  //     {
-  //      element.setAttribute(i + 1);
-  //     }, cc);
-  // }
+  const auto labels = mesh.ccl(
+     [](const Element& el1, const Element& el2)
+     {
+      return el1.getAttribute() == el2.getAttribute();
+     });
+
+  const size_t count =
+    labels.empty() ? 0 : *std::max_element(labels.begin(), labels.end()) + 1;
+  Alert::Info() << count << " components found." << Alert::Raise;
+
+  for (size_t i = 0; i < labels.size(); i++)
+    mesh.setAttribute(mesh.getDimension(), i, labels[i] + 1);
 
   Alert::Info() << "Saved mesh to ccl.mesh" << Alert::Raise;
 
@@ -15,5 +15,6 @@
 #include "Geometry/Mesh.h"
 #include "Geometry/SubMesh.h"
 #include "Geometry/Simplex.h"
+#include "Geometry/Partition.h"
 
 #endif
@@ -0,0 +1,98 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cmath>
+
+#include "Rodin/Configure.h"
+
+#include "Simplex.h"
+
+#include "AffineTransformation.h"
+
+namespace Rodin::Geometry
+{
+  AffineTransformation::AffineTransformation()
+    : m_geometry(Type::Point),
+      m_determinant(0),
+      m_elementType(mfem::ElementTransformation::ELEMENT),
+      m_index(0),
+      m_attribute(RODIN_DEFAULT_SIMPLEX_ATTRIBUTE)
+  {}
+
+  AffineTransformation::AffineTransformation(Type geometry, const Math::Matrix& vertices)
+    : m_geometry(geometry),
+      m_elementType(mfem::ElementTransformation::ELEMENT),
+      m_index(0),
+      m_attribute(RODIN_DEFAULT_SIMPLEX_ATTRIBUTE)
+  {
+    assert(isAffine(geometry));
+    assert(vertices.cols() > 1);
+    const size_t sdim = vertices.rows();
+    const size_t rdim = vertices.cols() - 1;
+    m_translation = vertices.col(0);
+    m_matrix.resize(sdim, rdim);
+    for (size_t i = 0; i < rdim; i++)
+      m_matrix.col(i) = vertices.col(i + 1) - vertices.col(0);
+    if (sdim == rdim)
+    {
+      m_determinant = m_matrix.determinant();
+      m_inverse = m_matrix.inverse();
+    }
+    else
+    {
+      const Math::SpatialMatrix gram = m_matrix.transpose() * m_matrix;
+      m_determinant = std::sqrt(gram.determinant());
+      m_inverse = gram.inverse() * m_matrix.transpose();
+    }
+  }
+
+  AffineTransformation::AffineTransformation(const AffineTransformation& other) = default;
+
+  AffineTransformation::AffineTransformation(AffineTransformation&& other) = default;
+
+  AffineTransformation&
+  AffineTransformation::operator=(const AffineTransformation& other) = default;
+
+  AffineTransformation&
+  AffineTransformation::operator=(AffineTransformation&& other) = default;
+
+  mfem::IsoparametricTransformation&
+  AffineTransformation::getHandle(mfem::IsoparametricTransformation& trans) const
+  {
+    const size_t sdim = m_matrix.rows();
+    const size_t rdim = m_matrix.cols();
+    trans.Attribute = m_attribute;
+    trans.ElementNo = m_index;
+    trans.ElementType = m_elementType;
+    trans.mesh = nullptr;
+    mfem::DenseMatrix& pm = trans.GetPointMat();
+    pm.SetSize(sdim, rdim + 1);
+    for (size_t i = 0; i < sdim; i++)
+    {
+      pm(i, 0) = m_translation.coeff(i);
+      for (size_t j = 0; j < rdim; j++)
+        pm(i, j + 1) = m_translation.coeff(i) + m_matrix.coeff(i, j);
+    }
+    trans.SetFE(
+        mfem::Mesh::GetTransformationFEforElementType(
+          mfem::Element::TypeFromGeometry(static_cast<mfem::Geometry::Type>(m_geometry))));
+    trans.Reset();
+    return trans;
+  }
+
+  bool AffineTransformation::isAffine(Type geometry)
+  {
+    switch (geometry)
+    {
+      case Type::Segment:
+      case Type::Triangle:
+      case Type::Tetrahedron:
+        return true;
+      default:
+        return false;
+    }
+  }
+}
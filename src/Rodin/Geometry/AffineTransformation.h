@@ -0,0 +1,166 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_GEOMETRY_AFFINETRANSFORMATION_H
+#define RODIN_GEOMETRY_AFFINETRANSFORMATION_H
+
+#include <mfem.hpp>
+
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/Matrix.h"
+
+#include "ForwardDecls.h"
+#include "SimplexTransformation.h"
+
+namespace Rodin::Geometry
+{
+  /**
+   * @brief Transformation of a straight sided simplex.
+   *
+   * The transformation of a segment, triangle or tetrahedron with straight
+   * sides is the affine map:
+   * @f[
+   *    x(r) = \mathbf{A} r + b
+   * @f]
+   * whose jacobian, inverse and distortion are constant. They are computed
+   * once on construction and stored inline, so that the transformations of
+   * all the simplices of a mesh live in one contiguous array.
+   *
+   * No mfem::IsoparametricTransformation is kept per simplex. Instead,
+   * getHandle() builds the handle in storage owned by the caller.
+   */
+  class AffineTransformation final : public SimplexTransformation
+  {
+    public:
+      /**
+       * @brief Constructs an empty transformation, to be assigned later.
+       */
+      AffineTransformation();
+
+      /**
+       * @brief Constructs the transformation of a simplex from its
+       * vertices.
+       * @param[in] geometry Geometry of the simplex
+       * @param[in] vertices Physical coordinates of the vertices, one vertex
+       * per column, in the order of the reference vertices.
+       */
+      AffineTransformation(Type geometry, const Math::Matrix& vertices);
+
+      AffineTransformation(const AffineTransformation& other);
+
+      AffineTransformation(AffineTransformation&& other);
+
+      ~AffineTransformation() = default;
+
+      AffineTransformation& operator=(AffineTransformation&& other);
+
+      AffineTransformation& operator=(const AffineTransformation& other);
+
+      /**
+       * @brief Sets the data which MFEM reads from the handle.
+       */
+      AffineTransformation& setHandleData(int elementType, Index index, Attribute attr)
+      {
+        m_elementType = elementType;
+        m_index = index;
+        m_attribute = attr;
+        return *this;
+      }
+
+      inline
+      Math::SpatialVector transform(const Math::Vector& rc) const override
+      {
+        return m_matrix * rc + m_translation;
+      }
+
+      inline
+      Math::SpatialMatrix jacobian(const Math::Vector&) const override
+      {
+        return m_matrix;
+      }
+
+      inline
+      Math::SpatialMatrix jacobianInverse(const Math::Vector&) const override
+      {
+        return m_inverse;
+      }
+
+      inline
+      Scalar distortion(const Math::Vector&) const override
+      {
+        return m_determinant;
+      }
+
+      inline
+      size_t getDistortionOrder() const override
+      {
+        return 0;
+      }
+
+      /**
+       * @brief Gets the matrix @f$ \mathbf{A} @f$ of the transformation.
+       */
+      inline
+      const Math::SpatialMatrix& getMatrix() const
+      {
+        return m_matrix;
+      }
+
+      /**
+       * @brief Gets the translation @f$ b @f$ of the transformation.
+       */
+      inline
+      const Math::SpatialVector& getTranslation() const
+      {
+        return m_translation;
+      }
+
+      /**
+       * @brief Gets the (pseudo-)inverse of @f$ \mathbf{A} @f$.
+       */
+      inline
+      const Math::SpatialMatrix& getInverse() const
+      {
+        return m_inverse;
+      }
+
+      /**
+       * @brief Gets the determinant of @f$ \mathbf{A} @f$ if it is square,
+       * and @f$ \sqrt{\det(\mathbf{A}^T \mathbf{A})} @f$ otherwise.
+       */
+      inline
+      Scalar getDeterminant() const
+      {
+        return m_determinant;
+      }
+
+      /**
+       * @brief Builds a handle to the transformation in @p storage.
+       * @returns A reference to @p storage.
+       */
+      mfem::IsoparametricTransformation& getHandle(
+          mfem::IsoparametricTransformation& storage) const override;
+
+      /**
+       * @brief Determines if the transformation of a simplex of the given
+       * geometry is affine, when its sides are straight.
+       */
+      static bool isAffine(Type geometry);
+
+    private:
+      Type m_geometry;
+      Math::SpatialMatrix m_matrix;
+      Math::SpatialVector m_translation;
+      Math::SpatialMatrix m_inverse;
+      Scalar m_determinant;
+
+      int m_elementType;
+      Index m_index;
+      Attribute m_attribute;
+  };
+}
+
+#endif
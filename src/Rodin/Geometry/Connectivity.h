@@ -8,6 +8,8 @@
 #define RODIN_GEOMETRY_CONNECTIVITY_H
 
 #include <vector>
+#include <cassert>
+#include <algorithm>
 
 #include "Rodin/Array.h"
 
@@ -27,14 +29,24 @@ namespace Rodin::Geometry
   class Connectivity
   {
     public:
+      /**
+       * @brief Indices of the simplices incident to one simplex, viewing the
+       * storage of the Connectivity object.
+       */
+      using Incidence = Eigen::Map<const Array<Index>>;
+
       Connectivity(size_t d, size_t dp, size_t n = 0)
-        : m_left(d), m_right(dp), m_connectivity(n)
+        : m_left(d), m_right(dp), m_offsets(n + 1, 0)
       {}
 
       Connectivity(const Connectivity&) = default;
 
       Connectivity(Connectivity&&) = default;
 
+      Connectivity& operator=(const Connectivity&) = default;
+
+      Connectivity& operator=(Connectivity&&) = default;
+
       size_t getLeft() const
       {
         return m_left;
@@ -47,21 +59,61 @@ namespace Rodin::Geometry
 
       size_t getSize() const
       {
-        return m_connectivity.size();
+        return m_offsets.size() - 1;
       }
 
+      /**
+       * @brief Sets the number of simplices of dimension @f$ d @f$. The
+       * simplices which are added have no incident simplices.
+       */
       Connectivity& setSize(size_t size)
       {
-        m_connectivity.resize(size);
+        m_offsets.resize(size + 1, m_offsets.back());
+        m_indices.resize(m_offsets.back());
         return *this;
       }
 
+      /**
+       * @brief Sets the incident simplices of the simplex @f$ (d, i) @f$.
+       *
+       * The simplex must either be the last one or already have the same
+       * number of incident simplices, so that the storage is not shifted.
+       */
       Connectivity& connect(Index idx, const Array<Index>& incidence)
       {
-        if (idx + 1 > m_connectivity.size())
-          m_connectivity.resize(idx + 1);
-        assert(idx < m_connectivity.size());
-        m_connectivity[idx] = incidence;
+        return connect(idx, incidence.data(), incidence.size());
+      }
+
+      Connectivity& connect(Index idx, const Index* incidence, size_t n)
+      {
+        if (idx + 1 > getSize())
+          setSize(idx + 1);
+        assert(idx < getSize());
+        const size_t begin = m_offsets[idx];
+        if (idx + 1 == getSize())
+        {
+          m_indices.resize(begin + n);
+          m_offsets[idx + 1] = begin + n;
+        }
+        assert(m_offsets[idx + 1] - begin == n);
+        std::copy_n(incidence, n, m_indices.begin() + begin);
+        return *this;
+      }
+
+      /**
+       * @brief Sets all the incidence relations at once, in compressed row
+       * storage.
+       * @param[in] offsets Offsets of the incident simplices of each
+       * simplex in @p indices, of size one more than the number of
+       * simplices and starting at zero.
+       * @param[in] indices Incident simplices, one simplex after the other
+       */
+      Connectivity& connect(std::vector<size_t> offsets, std::vector<Index> indices)
+      {
+        assert(!offsets.empty() && offsets.front() == 0);
+        assert(offsets.back() == indices.size());
+        m_offsets = std::move(offsets);
+        m_indices = std::move(indices);
         return *this;
       }
 
@@ -69,10 +121,11 @@ namespace Rodin::Geometry
        * @brief Gets the indices of the simplices of dimension @f$ d' @f$,
        * incident to the simplex @f$ (d, i) @f$.
        */
-      const Array<Index>& getIncidence(Index idx) const
+      Incidence getIncidence(Index idx) const
       {
         assert(idx < getSize());
-        return m_connectivity[idx];
+        return Incidence(
+            m_indices.data() + m_offsets[idx], m_offsets[idx + 1] - m_offsets[idx]);
       }
 
       void build(size_t d)
@@ -92,7 +145,8 @@ namespace Rodin::Geometry
 
     private:
       size_t m_left, m_right;
-      std::vector<Array<Index>> m_connectivity;
+      std::vector<size_t> m_offsets;
+      std::vector<Index> m_indices;
   };
 }
 
@@ -43,6 +43,8 @@ namespace Rodin::Geometry
 
   class MeshBase;
 
+  class Partition;
+
   /**
    * @brief Templated class for Mesh.
    */
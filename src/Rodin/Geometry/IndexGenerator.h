@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "ForwardDecls.h"
 #include "Simplex.h"
@@ -176,6 +177,73 @@ namespace Rodin::Geometry
       std::vector<Index>::iterator m_it;
 
   };
+
+  /**
+   * @brief Shared, immutable list of indices.
+   */
+  using IndexList = std::shared_ptr<const std::vector<Index>>;
+
+  /**
+   * @brief Generates the indices of a list which is shared with another
+   * object.
+   *
+   * The generator shares the ownership of the list, hence the list stays
+   * valid while the generator is alive even if its owner replaces it.
+   */
+  class RangeIndexGenerator final : public IndexGeneratorBase
+  {
+    public:
+      using Iterator = std::vector<Index>::const_iterator;
+
+      RangeIndexGenerator(IndexList indices)
+        : m_indices(std::move(indices)),
+          m_curr(m_indices->begin()), m_end(m_indices->end())
+      {}
+
+      RangeIndexGenerator(RangeIndexGenerator&& other)
+        :  IndexGeneratorBase(std::move(other)),
+          m_indices(std::move(other.m_indices)),
+          m_curr(other.m_curr), m_end(other.m_end)
+      {}
+
+      RangeIndexGenerator(const RangeIndexGenerator& other)
+        :  IndexGeneratorBase(other),
+          m_indices(other.m_indices),
+          m_curr(other.m_curr), m_end(other.m_end)
+      {}
+
+      bool end() const override
+      {
+        return m_curr == m_end;
+      }
+
+      RangeIndexGenerator& operator++() override
+      {
+        ++m_curr;
+        return *this;
+      }
+
+      Index operator*() const noexcept override
+      {
+        assert(!end());
+        return *m_curr;
+      }
+
+      RangeIndexGenerator* copy() & noexcept override
+      {
+        return new RangeIndexGenerator(*this);
+      }
+
+      RangeIndexGenerator* move() && noexcept override
+      {
+        return new RangeIndexGenerator(std::move(*this));
+      }
+
+    private:
+      IndexList m_indices;
+      Iterator m_curr;
+      const Iterator m_end;
+  };
 }
 
 #endif
@@ -48,7 +48,14 @@ namespace Rodin::Geometry
       // }
 
       inline
-      mfem::IsoparametricTransformation& getHandle() const final override
+      mfem::IsoparametricTransformation& getHandle() const
+      {
+        return *m_handle;
+      }
+
+      inline
+      mfem::IsoparametricTransformation& getHandle(
+          mfem::IsoparametricTransformation&) const final override
       {
         return *m_handle;
       }
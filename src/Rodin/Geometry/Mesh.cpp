@@ -4,14 +4,19 @@
  *       (See accompanying file LICENSE or copy at
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
+#include <cmath>
+#include <algorithm>
+
 #include "Rodin/Alert.h"
 #include "Rodin/IO/MeshLoader.h"
 #include "Rodin/IO/MeshPrinter.h"
 #include "Rodin/Variational/GridFunction.h"
 #include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/QuadratureRule.h"
 
 #include "Mesh.h"
 #include "SubMesh.h"
+#include "Partition.h"
 
 #include "Simplex.h"
 #include "SimplexIterator.h"
@@ -21,6 +26,51 @@
 namespace Rodin::Geometry
 {
   // ---- MeshBase ----------------------------------------------------------
+  namespace
+  {
+    /**
+     * Gets a generation which was never returned before.
+     */
+    size_t generate()
+    {
+      static std::atomic<size_t> s_generation(0);
+      return s_generation.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+  }
+
+  MeshBase::MeshBase()
+  {
+    m_generations.fill(generate());
+  }
+
+  MeshBase::MeshBase(const MeshBase&)
+    : MeshBase()
+  {}
+
+  MeshBase::MeshBase(MeshBase&&)
+    : MeshBase()
+  {}
+
+  MeshBase& MeshBase::operator=(const MeshBase&)
+  {
+    m_generations.fill(generate());
+    return *this;
+  }
+
+  MeshBase& MeshBase::operator=(MeshBase&&)
+  {
+    m_generations.fill(generate());
+    return *this;
+  }
+
+  void MeshBase::modify(Data data)
+  {
+    if (data == Data::Topology)
+      m_generations.fill(generate());
+    else
+      m_generations[static_cast<size_t>(data)] = generate();
+  }
+
   bool MeshBase::isSurface() const
   {
     return (getSpaceDimension() - 1 == getDimension());
@@ -49,86 +99,426 @@ namespace Rodin::Geometry
     return m_sdim;
   }
 
-  const SimplexTransformation&
-  Mesh<Context::Serial>::getSimplexTransformation(size_t dimension, Index idx) const
+  Mesh<Context::Serial>::TransformationCache::TransformationCache(size_t n)
+    : count(n), simplices(new std::atomic<SimplexTransformation*>[n])
+  {
+    for (size_t i = 0; i < count; i++)
+      simplices[i].store(nullptr, std::memory_order_relaxed);
+  }
+
+  Mesh<Context::Serial>::TransformationCache::~TransformationCache()
+  {
+    for (size_t i = 0; i < count; i++)
+      delete simplices[i].load(std::memory_order_relaxed);
+  }
+
+  void Mesh<Context::Serial>::flush()
+  {
+    m_transformations.clear();
+    m_transformations.reserve(m_count.size());
+    for (size_t d = 0; d < m_count.size(); d++)
+      m_transformations.emplace_back(new TransformationCache(m_count[d]));
+  }
+
+  const std::vector<AffineTransformation>&
+  Mesh<Context::Serial>::getAffineTransformations(size_t dimension) const
   {
     assert(m_transformations.size() > dimension);
-    assert(m_transformations[dimension].size() > idx);
-    if (m_transformations[dimension][idx])
+    auto& cache = *m_transformations[dimension];
+    std::call_once(cache.affineFlag,
+        [&]()
+        {
+          const mfem::Mesh& meshHandle = getHandle();
+          const bool isElement = (dimension == getDimension());
+          assert(isElement || dimension == getDimension() - 1);
+          const auto getGeometry =
+            [&](Index i)
+            {
+              return static_cast<Type>(
+                  isElement ? meshHandle.GetElementGeometry(i) : meshHandle.GetFaceGeometry(i));
+            };
+
+          const size_t count = cache.count;
+          bool affine = !meshHandle.GetNodes();
+          for (size_t i = 0; affine && i < count; i++)
+            affine = AffineTransformation::isAffine(getGeometry(i));
+          if (!affine)
+            return;
+
+          std::vector<AffineTransformation> res(count);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel
+#endif
+          {
+            mfem::Array<int> v;
+            Math::Matrix vertices;
+#ifdef RODIN_USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+            for (size_t i = 0; i < count; i++)
+              res[i] = createAffineTransformation(dimension, i, v, vertices);
+          }
+          cache.affine = std::move(res);
+        });
+    return cache.affine;
+  }
+
+  AffineTransformation
+  Mesh<Context::Serial>::createAffineTransformation(
+      size_t dimension, Index idx, mfem::Array<int>& v, Math::Matrix& vertices) const
+  {
+    const mfem::Mesh& meshHandle = getHandle();
+    const bool isElement = (dimension == getDimension());
+    const size_t sdim = getSpaceDimension();
+    if (isElement)
+      meshHandle.GetElementVertices(idx, v);
+    else
+      meshHandle.GetFaceVertices(idx, v);
+    vertices.resize(sdim, v.Size());
+    for (int j = 0; j < v.Size(); j++)
     {
-      return *m_transformations[dimension][idx];
+      const double* x = meshHandle.GetVertex(v[j]);
+      for (size_t k = 0; k < sdim; k++)
+        vertices(k, j) = x[k];
     }
-    else
+    const Type geometry = static_cast<Type>(
+        isElement ? meshHandle.GetElementGeometry(idx) : meshHandle.GetFaceGeometry(idx));
+    AffineTransformation res(geometry, vertices);
+    res.setHandleData(
+        isElement ? mfem::ElementTransformation::ELEMENT : mfem::ElementTransformation::FACE,
+        idx, getAttribute(dimension, idx));
+    return res;
+  }
+
+  const Connectivity& Mesh<Context::Serial>::getVertexIncidence(size_t dimension)
+  {
+    assert(dimension > 0);
+    assert(dimension == getDimension() || dimension == getDimension() - 1);
+    Connectivity& res = m_connectivity[0][dimension];
+    const size_t nv = getCount(0);
+    if (res.getSize() == nv)
+      return res;
+
+    // Transposes the vertices of each simplex, in two passes over the
+    // simplices so that the incidence is stored in compressed rows
+    const mfem::Mesh& meshHandle = getHandle();
+    const bool isElement = (dimension == getDimension());
+    const size_t count = getCount(dimension);
+    mfem::Array<int> v;
+    const auto getVertices =
+      [&](Index i)
+      {
+        if (isElement)
+          meshHandle.GetElementVertices(i, v);
+        else
+          meshHandle.GetFaceVertices(i, v);
+      };
+
+    std::vector<size_t> offsets(nv + 1, 0);
+    for (size_t i = 0; i < count; i++)
     {
-      const auto attribute = getAttribute(dimension, idx);
-      const mfem::Mesh& meshHandle = getHandle();
-      const mfem::GridFunction* nodes = meshHandle.GetNodes();
-      if (dimension == getDimension())
+      getVertices(i);
+      for (int j = 0; j < v.Size(); j++)
+        offsets[v[j] + 1]++;
+    }
+    for (size_t i = 0; i < nv; i++)
+      offsets[i + 1] += offsets[i];
+
+    std::vector<Index> indices(offsets[nv]);
+    std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < count; i++)
+    {
+      getVertices(i);
+      for (int j = 0; j < v.Size(); j++)
+        indices[next[v[j]]++] = i;
+    }
+    res.connect(std::move(offsets), std::move(indices));
+    return res;
+  }
+
+  void Mesh<Context::Serial>::updateTransformations(const std::vector<Index>& vertices)
+  {
+    if (vertices.empty())
+      return;
+
+    const mfem::Mesh& meshHandle = getHandle();
+    if (meshHandle.GetNodes())
+    {
+      flush();
+      return;
+    }
+
+    // Only the transformations of the elements and faces are cached
+    for (size_t d = getDimension() - 1; d <= getDimension(); d++)
+    {
+      auto& cache = *m_transformations[d];
+      const bool isElement = (d == getDimension());
+
+      // Only the simplices incident to the moved vertices are visited. In
+      // dimension one, the faces are the vertices themselves.
+      std::vector<Index> affected;
+      if (d == 0)
       {
-        if (!nodes)
+        affected = vertices;
+      }
+      else
+      {
+        const Connectivity& incidence = getVertexIncidence(d);
+        for (const Index v : vertices)
         {
-          mfem::IsoparametricTransformation* trans = new mfem::IsoparametricTransformation;
-          trans->Attribute = attribute;
-          trans->ElementNo = idx;
-          trans->ElementType = mfem::ElementTransformation::ELEMENT;
-          trans->mesh = nullptr;
-          trans->Reset();
-          meshHandle.GetPointMatrix(idx, trans->GetPointMat());
-          trans->SetFE(
-              meshHandle.GetTransformationFEforElementType(
-                meshHandle.GetElementType(idx)));
-          m_transformations[dimension][idx].reset(new IsoparametricTransformation(trans));
-          return *m_transformations[dimension][idx];
+          const auto simplices = incidence.getIncidence(v);
+          for (Eigen::Index k = 0; k < simplices.size(); k++)
+            affected.push_back(simplices.coeff(k));
         }
-        else
+        std::sort(affected.begin(), affected.end());
+        affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+      }
+
+      const size_t sdim = getSpaceDimension();
+      const size_t count = affected.size();
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel
+#endif
+      {
+        mfem::Array<int> v;
+        Math::Matrix pm;
+#ifdef RODIN_USE_OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (size_t k = 0; k < count; k++)
         {
-          assert(false);
-          return *m_transformations[dimension][idx];
+          const Index i = affected[k];
+          if (!cache.affine.empty())
+          {
+            cache.affine[i] = createAffineTransformation(d, i, v, pm);
+          }
+          else if (SimplexTransformation* trans = cache.simplices[i].load(std::memory_order_relaxed))
+          {
+            // The transformation is updated in place, so that the
+            // references to it stay valid
+            mfem::IsoparametricTransformation& handle =
+              static_cast<IsoparametricTransformation*>(trans)->getHandle();
+            mfem::DenseMatrix& points = handle.GetPointMat();
+            if (isElement)
+            {
+              meshHandle.GetPointMatrix(i, points);
+            }
+            else
+            {
+              meshHandle.GetFaceVertices(i, v);
+              points.SetSize(sdim, v.Size());
+              for (size_t r = 0; r < sdim; r++)
+                for (int j = 0; j < v.Size(); j++)
+                  points(r, j) = meshHandle.GetVertex(v[j])[r];
+            }
+            handle.Reset();
+          }
         }
       }
-      else if (dimension == getDimension() - 1)
+    }
+  }
+
+  const SimplexTransformation&
+  Mesh<Context::Serial>::getSimplexTransformation(size_t dimension, Index idx) const
+  {
+    assert(m_transformations.size() > dimension);
+    assert(m_transformations[dimension]->count > idx);
+    if (dimension > 0)
+    {
+      const auto& affine = getAffineTransformations(dimension);
+      if (!affine.empty())
+        return affine[idx];
+    }
+
+    auto& slot = m_transformations[dimension]->simplices[idx];
+    if (SimplexTransformation* trans = slot.load(std::memory_order_acquire))
+      return *trans;
+
+    // If several threads build the same transformation, only the first one
+    // to finish is kept
+    std::unique_ptr<SimplexTransformation> trans(createSimplexTransformation(dimension, idx));
+    assert(trans);
+    SimplexTransformation* expected = nullptr;
+    if (slot.compare_exchange_strong(expected, trans.get(), std::memory_order_acq_rel))
+      return *trans.release();
+    else
+      return *expected;
+  }
+
+  void Mesh<Context::Serial>::precomputeTransformations(size_t dimension) const
+  {
+    if (dimension > 0 && !getAffineTransformations(dimension).empty())
+      return;
+    const size_t count = getCount(dimension);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < count; i++)
+      getSimplexTransformation(dimension, i);
+  }
+
+  std::vector<Scalar> Mesh<Context::Serial>::getMeasures(
+      size_t dimension, const IndexList& indices, const std::vector<Attribute>& attributes) const
+  {
+    assert(std::is_sorted(attributes.begin(), attributes.end()));
+    const size_t na = std::max<size_t>(attributes.size(), 1);
+
+    // Position of each attribute in the sums, or na if it is left out
+    std::vector<size_t> position;
+    if (!attributes.empty())
+    {
+      position.assign(attributes.back() + 1, na);
+      for (size_t a = 0; a < attributes.size(); a++)
+        position[attributes[a]] = a;
+    }
+
+    // The measure of an affine simplex is |det(A)| times the measure of the
+    // reference simplex, which is 1 / d!
+    const std::vector<AffineTransformation>* affine = nullptr;
+    Scalar reference = 1;
+    if (dimension > 0)
+    {
+      affine = &getAffineTransformations(dimension);
+      if (affine->empty())
+        affine = nullptr;
+      for (size_t k = 2; k <= dimension; k++)
+        reference /= k;
+    }
+    if (!affine)
+      precomputeTransformations(dimension);
+
+    const size_t n = indices ? indices->size() : getCount(dimension);
+    constexpr size_t blockSize = 1024;
+    const size_t nb = (n + blockSize - 1) / blockSize;
+    std::vector<Scalar> sums(nb * na, 0.0);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t b = 0; b < nb; b++)
+    {
+      Scalar* block = sums.data() + b * na;
+      const size_t end = std::min(n, (b + 1) * blockSize);
+      for (size_t i = b * blockSize; i < end; i++)
       {
-        if (!nodes)
+        const Index idx = indices ? (*indices)[i] : i;
+        size_t a = 0;
+        if (!attributes.empty())
+        {
+          const Attribute attr = getAttribute(dimension, idx);
+          if (attr >= position.size() || position[attr] == na)
+            continue;
+          a = position[attr];
+        }
+        if (affine)
         {
-          mfem::IsoparametricTransformation* trans = new mfem::IsoparametricTransformation;
-          trans->Attribute = attribute;
-          trans->ElementNo = idx;
-          trans->ElementType = mfem::ElementTransformation::FACE;
-          trans->mesh = nullptr;
-          mfem::DenseMatrix& pm = trans->GetPointMat();
-          trans->Reset();
-          const size_t spaceDim = getSpaceDimension();
-
-          mfem::Array<int> v;
-          meshHandle.GetFaceVertices(idx, v);
-          const int nv = v.Size();
-          pm.SetSize(spaceDim, nv);
-          for (size_t i = 0; i < spaceDim; i++)
-            for (int j = 0; j < nv; j++)
-              pm(i, j) = meshHandle.GetVertex(v[j])[i];
-          trans->SetFE(
-              meshHandle.GetTransformationFEforElementType(
-                meshHandle.GetFaceElementType(idx)));
-          m_transformations[dimension][idx].reset(new IsoparametricTransformation(trans));
-          return *m_transformations[dimension][idx];
+          block[a] += std::abs((*affine)[idx].getDeterminant()) * reference;
         }
         else
         {
-          assert(false);
-          return *m_transformations[dimension][idx];
+          const Type geometry = static_cast<Type>(
+              dimension == getDimension() ?
+                getHandle().GetElementGeometry(idx) : getHandle().GetFaceGeometry(idx));
+          const SimplexTransformation& trans = getSimplexTransformation(dimension, idx);
+          const Variational::QuadratureRule& qr =
+            Variational::QuadratureRule::get(geometry, trans.getDistortionOrder());
+          for (size_t k = 0; k < qr.size(); k++)
+            block[a] += qr.getWeight(k) * trans.distortion(qr.getPoint(k));
         }
       }
-      else if (dimension == 0)
+    }
+
+    std::vector<Scalar> res(na, 0.0);
+    for (size_t b = 0; b < nb; b++)
+    {
+      for (size_t a = 0; a < na; a++)
+        res[a] += sums[b * na + a];
+    }
+    return res;
+  }
+
+  SimplexTransformation*
+  Mesh<Context::Serial>::createSimplexTransformation(size_t dimension, Index idx) const
+  {
+    const auto attribute = getAttribute(dimension, idx);
+    const mfem::Mesh& meshHandle = getHandle();
+    const mfem::GridFunction* nodes = meshHandle.GetNodes();
+    if (dimension == getDimension())
+    {
+      if (!nodes)
+      {
+        mfem::IsoparametricTransformation* trans = new mfem::IsoparametricTransformation;
+        trans->Attribute = attribute;
+        trans->ElementNo = idx;
+        trans->ElementType = mfem::ElementTransformation::ELEMENT;
+        trans->mesh = nullptr;
+        trans->Reset();
+        meshHandle.GetPointMatrix(idx, trans->GetPointMat());
+        trans->SetFE(
+            meshHandle.GetTransformationFEforElementType(
+              meshHandle.GetElementType(idx)));
+        return new IsoparametricTransformation(trans);
+      }
+      else
       {
         assert(false);
-        return *m_transformations[dimension][idx];
+        return nullptr;
+      }
+    }
+    else if (dimension == getDimension() - 1)
+    {
+      if (!nodes)
+      {
+        mfem::IsoparametricTransformation* trans = new mfem::IsoparametricTransformation;
+        trans->Attribute = attribute;
+        trans->ElementNo = idx;
+        trans->ElementType = mfem::ElementTransformation::FACE;
+        trans->mesh = nullptr;
+        mfem::DenseMatrix& pm = trans->GetPointMat();
+        trans->Reset();
+        const size_t spaceDim = getSpaceDimension();
+
+        mfem::Array<int> v;
+        meshHandle.GetFaceVertices(idx, v);
+        const int nv = v.Size();
+        pm.SetSize(spaceDim, nv);
+        for (size_t i = 0; i < spaceDim; i++)
+          for (int j = 0; j < nv; j++)
+            pm(i, j) = meshHandle.GetVertex(v[j])[i];
+        trans->SetFE(
+            meshHandle.GetTransformationFEforElementType(
+              meshHandle.GetFaceElementType(idx)));
+        return new IsoparametricTransformation(trans);
       }
       else
       {
         assert(false);
-        return *m_transformations[dimension][idx];
+        return nullptr;
       }
     }
+    else if (dimension == 0)
+    {
+      assert(false);
+      return nullptr;
+    }
+    else
+    {
+      assert(false);
+      return nullptr;
+    }
+  }
+
+  bool Mesh<Context::Serial>::getAttributeChanges(
+      size_t generation, std::vector<std::pair<size_t, Index>>& changes) const
+  {
+    changes.clear();
+    if (generation < m_attributeChangesStart)
+      return false;
+    auto it = std::upper_bound(
+        m_attributeChanges.begin(), m_attributeChanges.end(), generation,
+        [](size_t g, const AttributeChange& change) { return g < change.generation; });
+    for (; it != m_attributeChanges.end(); ++it)
+      changes.emplace_back(it->dimension, it->index);
+    return true;
   }
 
   Mesh<Context::Serial>& Mesh<Context::Serial>::scale(Scalar c)
@@ -137,6 +527,40 @@ namespace Rodin::Geometry
     getHandle().GetVertices(vs);
     vs *= c;
     getHandle().SetVertices(vs);
+    modify(Data::Geometry);
+    flush();
+    return *this;
+  }
+
+  Mesh<Context::Serial>& Mesh<Context::Serial>::reorder(const std::vector<Index>& ordering)
+  {
+    assert(ordering.size() == getCount(getDimension()));
+    mfem::Array<int> tmp(ordering.size());
+    std::copy(ordering.begin(), ordering.end(), tmp.begin());
+    getHandle().ReorderElements(tmp, false);
+
+    const mfem::Mesh& handle = getHandle();
+    m_count[m_dim - 1] = handle.GetNumFaces();
+
+    std::vector<size_t> offsets(handle.GetNE() + 1, 0);
+    std::vector<Index> indices;
+    mfem::Array<int> vertices;
+    for (int i = 0; i < handle.GetNE(); i++)
+    {
+      handle.GetElementVertices(i, vertices);
+      indices.insert(indices.end(), vertices.begin(), vertices.end());
+      offsets[i + 1] = indices.size();
+    }
+    m_connectivity[m_dim][0].connect(std::move(offsets), std::move(indices));
+    for (size_t d = 0; d <= m_dim; d++)
+      m_connectivity[0][d] = Connectivity(0, d);
+
+    m_f2b.clear();
+    for (int i = 0; i < handle.GetNBE(); i++)
+      m_f2b[handle.GetBdrElementEdgeIndex(i)] = i;
+
+    modify(Data::Topology);
+    flush();
     return *this;
   }
 
@@ -181,81 +605,156 @@ namespace Rodin::Geometry
     }
   }
 
-  Scalar MeshBase::getVolume()
+  Scalar MeshBase::getVolume() const
+  {
+    return getMeasures(getDimension(), nullptr, {}).front();
+  }
+
+  Scalar MeshBase::getVolume(Attribute attr) const
   {
-    Scalar totalVolume = 0;
-    for (auto it = getElement(); !it.end(); ++it)
-      totalVolume += it->getVolume();
-    return totalVolume;
+    return getMeasures(getDimension(), getIndices(getDimension(), attr), {}).front();
   }
 
-  Scalar MeshBase::getVolume(Attribute attr)
+  Scalar MeshBase::getPerimeter() const
   {
-    Scalar totalVolume = 0;
-    for (auto it = getElement(); !it.end(); ++it)
+    return getMeasures(getDimension() - 1, getBoundaryIndices(), {}).front();
+  }
+
+  Scalar MeshBase::getPerimeter(Attribute attr) const
+  {
+    return getMeasures(getDimension() - 1, getBoundaryIndices(attr), {}).front();
+  }
+
+  std::map<Attribute, Scalar> MeshBase::getVolumes() const
+  {
+    const std::set<Attribute> attrs = getAttributes();
+    const std::vector<Attribute> attributes(attrs.begin(), attrs.end());
+    const std::vector<Scalar> measures = getMeasures(getDimension(), nullptr, attributes);
+    std::map<Attribute, Scalar> res;
+    for (size_t i = 0; i < attributes.size(); i++)
+      res.emplace_hint(res.end(), attributes[i], measures[i]);
+    return res;
+  }
+
+  std::map<Attribute, Scalar> MeshBase::getPerimeters() const
+  {
+    const std::set<Attribute> attrs = getBoundaryAttributes();
+    const std::vector<Attribute> attributes(attrs.begin(), attrs.end());
+    const std::vector<Scalar> measures =
+      getMeasures(getDimension() - 1, getBoundaryIndices(), attributes);
+    std::map<Attribute, Scalar> res;
+    for (size_t i = 0; i < attributes.size(); i++)
+      res.emplace_hint(res.end(), attributes[i], measures[i]);
+    return res;
+  }
+
+  namespace
+  {
+    /**
+     * Gets the representative of the set of the element, halving the path
+     * to it along the way.
+     */
+    Index find(std::vector<Index>& parent, Index i)
+    {
+      while (parent[i] != i)
+      {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+      }
+      return i;
+    }
+
+    /**
+     * Merges the sets of both elements, keeping the smallest representative.
+     */
+    void unite(std::vector<Index>& parent, Index i, Index j)
     {
-      if (it->getAttribute() == attr)
-        totalVolume += it->getVolume();
+      i = find(parent, i);
+      j = find(parent, j);
+      if (i < j)
+        parent[j] = i;
+      else if (j < i)
+        parent[i] = j;
+    }
+
+    std::vector<Index> label(std::vector<Index>& parent)
+    {
+      std::vector<Index> res(parent.size());
+      Index count = 0;
+      for (size_t i = 0; i < parent.size(); i++)
+      {
+        const Index root = find(parent, i);
+        res[i] = (root == i) ? count++ : res[root];
+      }
+      return res;
     }
-    return totalVolume;
   }
 
-  Scalar MeshBase::getPerimeter()
+  std::vector<Index> MeshBase::ccl(
+      std::function<bool(const Element&, const Element&)> p) const
   {
-    Scalar totalVolume = 0;
-    for (auto it = getBoundary(); !it.end(); ++it)
-      totalVolume += it->getVolume();
-    return totalVolume;
+    const mfem::Mesh& handle = getHandle();
+    std::vector<Index> parent(handle.GetNE());
+    for (size_t i = 0; i < parent.size(); i++)
+      parent[i] = i;
+    for (int f = 0; f < handle.GetNumFaces(); f++)
+    {
+      int e1, e2;
+      handle.GetFaceElements(f, &e1, &e2);
+      if (e1 < 0 || e2 < 0)
+        continue;
+      if (p(*getElement(e1), *getElement(e2)))
+        unite(parent, e1, e2);
+    }
+    return label(parent);
   }
 
-  Scalar MeshBase::getPerimeter(Attribute attr)
+  std::vector<Index> MeshBase::ccl(
+      std::function<bool(const Element&, const Element&)> p,
+      const Partition& partition) const
   {
-    Scalar totalVolume = 0;
-    for (auto it = getBoundary(); !it.end(); ++it)
+    const mfem::Mesh& handle = getHandle();
+    std::vector<Index> parent(handle.GetNE());
+    for (size_t i = 0; i < parent.size(); i++)
+      parent[i] = i;
+
+    // The sets of the elements of a part only ever contain elements of the
+    // same part until the interface is processed, hence the parts may be
+    // processed concurrently.
+    std::vector<std::vector<std::pair<Index, Index>>> pairs(partition.getCount());
+    std::vector<std::pair<Index, Index>> interface;
+    for (int f = 0; f < handle.GetNumFaces(); f++)
     {
-      if (it->getAttribute() == attr)
-        totalVolume += it->getVolume();
+      int e1, e2;
+      handle.GetFaceElements(f, &e1, &e2);
+      if (e1 < 0 || e2 < 0)
+        continue;
+      const size_t part = partition.getPart(e1);
+      if (part == partition.getPart(e2))
+        pairs[part].emplace_back(e1, e2);
+      else
+        interface.emplace_back(e1, e2);
     }
-    return totalVolume;
-  }
 
-  // std::deque<std::set<int>> MeshBase::ccl(
-  //     std::function<bool(const Element&, const Element&)> p) const
-  // {
-  //   std::set<int> visited;
-  //   std::deque<int> searchQueue;
-  //   std::deque<std::set<int>> res;
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (size_t part = 0; part < pairs.size(); part++)
+    {
+      for (const auto& [e1, e2] : pairs[part])
+      {
+        if (p(*getElement(e1), *getElement(e2)))
+          unite(parent, e1, e2);
+      }
+    }
 
-  //   // Perform the labelling
-  //   assert(false);
-  //   // for (int i = 0; i < count<Element>(); i++)
-  //   // {
-  //   //   if (!visited.count(i))
-  //   //   {
-  //   //     res.push_back({});
-  //   //     searchQueue.push_back(i);
-  //   //     while (searchQueue.size() > 0)
-  //   //     {
-  //   //       int el = searchQueue.back();
-  //   //       searchQueue.pop_back();
-  //   //       auto result = visited.insert(el);
-  //   //       bool inserted = result.second;
-  //   //       if (inserted)
-  //   //       {
-  //   //         res.back().insert(el);
-  //   //         for (int n : get<Element>(el).adjacent())
-  //   //         {
-  //   //           if (p(get<Element>(el), get<Element>(n)))
-  //   //           {
-  //   //             searchQueue.push_back(n);
-  //   //           }
-  //   //         }
-  //   //       }
-  //   //     }
-  //   //   }
-  //   // }
-  //   return res;
-  // }
+    for (const auto& [e1, e2] : interface)
+    {
+      if (p(*getElement(e1), *getElement(e2)))
+        unite(parent, e1, e2);
+    }
+    return label(parent);
+  }
 
   // ---- Mesh<Serial> ------------------------------------------------------
 #ifdef RODIN_USE_MPI
@@ -279,10 +778,7 @@ namespace Rodin::Geometry
     m_count[m_dim - 1] = getHandle().GetNumFaces();
     m_count[0] = getHandle().GetNV();
 
-    m_transformations.resize(m_dim + 1);
-    m_transformations[m_dim].resize(m_count[m_dim]);
-    m_transformations[m_dim - 1].resize(m_count[m_dim - 1]);
-    m_transformations[0].resize(m_count[0]);
+    flush();
 
     for (int i = 0; i < getHandle().GetNBE(); i++)
       m_f2b[getHandle().GetBdrElementEdgeIndex(i)] = i;
@@ -296,27 +792,106 @@ namespace Rodin::Geometry
 
   FaceIterator Mesh<Context::Serial>::getBoundary() const
   {
-    std::vector<Index> indices;
-    indices.reserve(getHandle().GetNBE());
-    for (int i = 0; i < getHandle().GetNBE(); i++)
+    return FaceIterator(*this, RangeIndexGenerator(getBoundaryIndices()));
+  }
+
+  FaceIterator Mesh<Context::Serial>::getInterface() const
+  {
+    return FaceIterator(*this, RangeIndexGenerator(getInterfaceIndices()));
+  }
+
+  std::shared_ptr<const Mesh<Context::Serial>::IndexLists>
+  Mesh<Context::Serial>::getIndexLists() const
+  {
+    assert(m_indexLists);
+    std::lock_guard<std::mutex> lock(m_indexLists->mutex);
+    const auto& current = m_indexLists->lists;
+    if (current && current->version.isCurrent(*this))
+      return current;
+
+    std::shared_ptr<IndexLists> lists = std::make_shared<IndexLists>();
+    lists->version.update(*this);
+    const mfem::Mesh& handle = getHandle();
+    for (int i = 0; i < handle.GetNE(); i++)
+      lists->elements[handle.GetAttribute(i)].push_back(i);
+
+    for (int i = 0; i < handle.GetNumFaces(); i++)
     {
-      int idx = getHandle().GetBdrFace(i);
-      if (!getHandle().FaceIsInterior(idx))
-        indices.push_back(idx);
+      const Attribute attr = getAttribute(getDimension() - 1, i);
+      lists->faces[attr].push_back(i);
+      if (handle.FaceIsInterior(i))
+      {
+        lists->interface.push_back(i);
+        lists->interfaceByAttribute[attr].push_back(i);
+      }
     }
-    return FaceIterator(*this, VectorIndexGenerator(std::move(indices)));
+
+    // The boundary is made of the faces of the boundary elements which are
+    // not interior to the mesh
+    lists->boundary.reserve(handle.GetNBE());
+    for (int i = 0; i < handle.GetNBE(); i++)
+    {
+      const int f = handle.GetBdrFace(i);
+      if (!handle.FaceIsInterior(f))
+      {
+        lists->boundary.push_back(f);
+        lists->boundaryByAttribute[handle.GetBdrAttribute(i)].push_back(f);
+      }
+    }
+
+    // Lists handed out before are released by their last holder
+    m_indexLists->lists = lists;
+    return lists;
   }
 
-  FaceIterator Mesh<Context::Serial>::getInterface() const
+  namespace
   {
-    std::vector<Index> indices;
-    indices.reserve(getHandle().GetNumFaces());
-    for (int idx = 0; idx < getHandle().GetNumFaces(); idx++)
+    template <class Lists>
+    IndexList find(const Lists& lists,
+        const std::map<Attribute, std::vector<Index>>& byAttribute, Attribute attr)
     {
-      if (getHandle().FaceIsInterior(idx))
-        indices.push_back(idx);
+      static const IndexList s_empty = std::make_shared<const std::vector<Index>>();
+      auto it = byAttribute.find(attr);
+      return it == byAttribute.end() ? s_empty : IndexList(lists, &it->second);
     }
-    return FaceIterator(*this, VectorIndexGenerator(std::move(indices)));
+  }
+
+  IndexList Mesh<Context::Serial>::getIndices(size_t dimension, Attribute attr) const
+  {
+    const auto lists = getIndexLists();
+    if (dimension == getDimension())
+    {
+      return find(lists, lists->elements, attr);
+    }
+    else
+    {
+      assert(dimension == getDimension() - 1);
+      return find(lists, lists->faces, attr);
+    }
+  }
+
+  IndexList Mesh<Context::Serial>::getBoundaryIndices() const
+  {
+    const auto lists = getIndexLists();
+    return IndexList(lists, &lists->boundary);
+  }
+
+  IndexList Mesh<Context::Serial>::getBoundaryIndices(Attribute attr) const
+  {
+    const auto lists = getIndexLists();
+    return find(lists, lists->boundaryByAttribute, attr);
+  }
+
+  IndexList Mesh<Context::Serial>::getInterfaceIndices() const
+  {
+    const auto lists = getIndexLists();
+    return IndexList(lists, &lists->interface);
+  }
+
+  IndexList Mesh<Context::Serial>::getInterfaceIndices(Attribute attr) const
+  {
+    const auto lists = getIndexLists();
+    return find(lists, lists->interfaceByAttribute, attr);
   }
 
   ElementIterator Mesh<Context::Serial>::getElement(Index idx) const
@@ -381,6 +956,17 @@ namespace Rodin::Geometry
   Mesh<Context::Serial>& Mesh<Context::Serial>
   ::setAttribute(size_t dimension, Index index, Attribute attr)
   {
+    const size_t previous = getGeneration(Data::Attributes);
+    modify(Data::Attributes);
+
+    // Past the number of simplices, the readers are better off rereading
+    // all the attributes than the record
+    if (m_attributeChanges.size() >= getElementCount() + getFaceCount())
+    {
+      m_attributeChanges.clear();
+      m_attributeChangesStart = previous;
+    }
+    m_attributeChanges.push_back({ getGeneration(Data::Attributes), dimension, index });
     if (dimension == getDimension())
     {
       getHandle().SetAttribute(index, attr);
@@ -400,6 +986,18 @@ namespace Rodin::Geometry
     else
     {
     }
+
+    // Keep the attribute of the cached transformation in sync
+    if (dimension > 0 && dimension < m_transformations.size())
+    {
+      auto& cache = *m_transformations[dimension];
+      const int elementType = dimension == getDimension() ?
+        mfem::ElementTransformation::ELEMENT : mfem::ElementTransformation::FACE;
+      if (!cache.affine.empty())
+        cache.affine[index].setHandleData(elementType, index, attr);
+      else if (SimplexTransformation* trans = cache.simplices[index].load(std::memory_order_relaxed))
+        static_cast<IsoparametricTransformation*>(trans)->getHandle().Attribute = attr;
+    }
     return *this;
   }
 
@@ -453,11 +1051,22 @@ namespace Rodin::Geometry
   SubMesh<Context::Serial> Mesh<Context::Serial>::keep(const std::set<Attribute>& attrs)
   {
     SubMesh<Context::Serial> res(*this);
-    std::set<Index> indices;
-    for (Index i = 0; i < getCount(getDimension()); i++)
+    const size_t ne = getCount(getDimension());
+    std::vector<char> kept(ne, false);
+    for (const Attribute attr : attrs)
+    {
+      const IndexList elements = getIndices(getDimension(), attr);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (size_t i = 0; i < elements->size(); i++)
+        kept[(*elements)[i]] = true;
+    }
+    std::vector<Index> indices;
+    for (Index i = 0; i < ne; i++)
     {
-      if (attrs.count(getAttribute(getDimension(), i)))
-        indices.insert(i);
+      if (kept[i])
+        indices.push_back(i);
     }
     res.initialize(getDimension(), getSpaceDimension())
        .include(getDimension(), indices)
@@ -479,11 +1088,8 @@ namespace Rodin::Geometry
   {
     assert(!getHandle().GetNodes()); // Curved mesh or discontinuous mesh not handled yet!
     SubMesh<Context::Serial> res(*this);
-    std::set<Index> indices;
-    for (auto it = getBoundary(); !it.end(); ++it)
-      indices.insert(it->getIndex());
     res.initialize(getDimension() - 1, getSpaceDimension())
-       .include(getDimension() - 1, indices)
+       .include(getDimension() - 1, *getBoundaryIndices())
        .finalize();
     return res;
   }
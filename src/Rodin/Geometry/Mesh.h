@@ -10,6 +10,14 @@
 #include <set>
 #include <string>
 #include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <optional>
 
 #include <mfem.hpp>
 
@@ -25,6 +33,7 @@
 #include "Simplex.h"
 #include "SimplexIterator.h"
 #include "SimplexTransformation.h"
+#include "AffineTransformation.h"
 
 namespace Rodin::Geometry
 {
@@ -42,8 +51,44 @@ namespace Rodin::Geometry
           virtual void finalize() = 0;
       };
 
+      /**
+       * @brief Data of a mesh on which a cache may depend.
+       * @see getGeneration(Data) const
+       */
+      enum class Data
+      {
+        /// Coordinates of the vertices and nodes
+        Geometry = 0,
+
+        /// Simplices and their numbering
+        Topology = 1,
+
+        /// Attributes of the simplices
+        Attributes = 2
+      };
+
       virtual ~MeshBase() = default;
 
+      /**
+       * @brief Gets the generation of some data of the mesh.
+       *
+       * The generation changes every time the data is modified. Two
+       * different meshes, or a mesh before and after it is assigned, never
+       * share a generation. Hence data computed from the mesh is up to date
+       * if the generations of what it depends on did not change since it
+       * was computed.
+       *
+       * A change of topology also changes the generations of the geometry
+       * and of the attributes, since the simplices are renumbered.
+       *
+       * @see MeshVersion
+       */
+      inline
+      size_t getGeneration(Data data) const
+      {
+        return m_generations[static_cast<size_t>(data)];
+      }
+
       virtual MeshBase& scale(Scalar c) = 0;
 
       /**
@@ -67,7 +112,47 @@ namespace Rodin::Geometry
       {
         assert(u.getFiniteElementSpace().getVectorDimension() == getSpaceDimension());
         getHandle().MoveNodes(u.getHandle());
-        flush();
+        modify(Data::Geometry);
+        if (getHandle().GetNodes())
+        {
+          flush();
+        }
+        else
+        {
+          // Without nodes, u holds the displacement of each vertex, one
+          // component after the other
+          const mfem::Vector& d = u.getHandle();
+          const size_t nv = getHandle().GetNV();
+          const size_t sdim = getSpaceDimension();
+          assert(static_cast<size_t>(d.Size()) == nv * sdim);
+          std::vector<Index> moved;
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel
+#endif
+          {
+            std::vector<Index> local;
+#ifdef RODIN_USE_OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+            for (size_t i = 0; i < nv; i++)
+            {
+              for (size_t k = 0; k < sdim; k++)
+              {
+                if (d(k * nv + i) != 0)
+                {
+                  local.push_back(i);
+                  break;
+                }
+              }
+            }
+            // The order does not matter to updateTransformations()
+#ifdef RODIN_USE_OPENMP
+#pragma omp critical
+#endif
+            moved.insert(moved.end(), local.begin(), local.end());
+          }
+          updateTransformations(moved);
+        }
         return *this;
       }
 
@@ -96,18 +181,37 @@ namespace Rodin::Geometry
         return res;
       }
 
-      // /**
-      //  * @brief Performs connected-component labelling.
-      //  * @param[in] p Function which returns true if two adjacent elements
-      //  * belong to the same component, false otherwise.
-      //  * @returns List of sets, each set representing a component containing
-      //  * the indices of its elements.
-      //  *
-      //  * @note Both elements passed to the function will always be adjacent
-      //  * to each other, i.e. it is not necessary to verify this is the case.
-      //  */
-      // std::deque<std::set<int>> ccl(
-      //     std::function<bool(const Element&, const Element&)> p) const;
+      /**
+       * @brief Performs connected-component labelling.
+       * @param[in] p Function which returns true if two adjacent elements
+       * belong to the same component, false otherwise.
+       * @returns Label of the component of each element. The labels are
+       * consecutive, starting from 0, and numbered in the order of the
+       * first element of each component.
+       *
+       * Two elements are adjacent if they share a face. The components are
+       * merged with a union-find structure over the interior faces.
+       *
+       * @note Both elements passed to the function will always be adjacent
+       * to each other, i.e. it is not necessary to verify this is the case.
+       */
+      std::vector<Index> ccl(
+          std::function<bool(const Element&, const Element&)> p) const;
+
+      /**
+       * @brief Performs connected-component labelling in parallel over the
+       * parts of a partition of the elements.
+       *
+       * The faces interior to each part are processed concurrently, one
+       * part per thread, and the faces of the interface are processed last.
+       * The result is the same as the one of
+       * ccl(std::function<bool(const Element&, const Element&)>) const.
+       *
+       * @note The function @p p may be called concurrently.
+       */
+      std::vector<Index> ccl(
+          std::function<bool(const Element&, const Element&)> p,
+          const Partition& partition) const;
 
       // /**
       //  * @brief Edits the specified elements in the mesh via the given function.
@@ -167,7 +271,7 @@ namespace Rodin::Geometry
        * @brief Gets the total volume of the mesh.
        * @returns Sum of all element volumes.
        */
-      Scalar getVolume();
+      Scalar getVolume() const;
 
       /**
        * @brief Gets the sum of the volumes of the elements given by the
@@ -177,13 +281,13 @@ namespace Rodin::Geometry
        * @note If the element attribute does not exist then this function
        * will return 0 as the volume.
        */
-      Scalar getVolume(Attribute attr);
+      Scalar getVolume(Attribute attr) const;
 
       /**
        * @brief Gets the total perimeter of the mesh.
        * @returns Sum of all element perimeters.
        */
-      Scalar getPerimeter();
+      Scalar getPerimeter() const;
 
       /**
        * @brief Gets the sum of the perimeters of the elements given by the
@@ -193,7 +297,28 @@ namespace Rodin::Geometry
        * @note If the element attribute does not exist then this function
        * will return 0 as the perimeter.
        */
-      Scalar getPerimeter(Attribute attr);
+      Scalar getPerimeter(Attribute attr) const;
+
+      /**
+       * @brief Gets the sum of the volumes of the elements of each
+       * attribute.
+       * @returns Map of each element attribute to the sum of the volumes of
+       * its elements.
+       *
+       * The elements are visited in a single parallel pass, so this is
+       * cheaper than calling getVolume(Attribute) for every attribute.
+       * @see getMeasures(size_t, const IndexList&, const std::vector<Attribute>&) const
+       */
+      std::map<Attribute, Scalar> getVolumes() const;
+
+      /**
+       * @brief Gets the sum of the volumes of the boundary faces of each
+       * attribute.
+       * @returns Map of each attribute of the boundary to the sum of the
+       * volumes of its faces.
+       * @see getVolumes() const
+       */
+      std::map<Attribute, Scalar> getPerimeters() const;
 
       /**
        * @brief Gets the labels of the domain elements in the mesh.
@@ -266,6 +391,47 @@ namespace Rodin::Geometry
 
       virtual FaceIterator getInterface() const = 0;
 
+      /**
+       * @brief Gets the indices of the simplices of the given dimension
+       * which have the given attribute.
+       * @param[in] dimension Dimension of the simplices, either the
+       * dimension of the elements or of the faces
+       * @param[in] attr Attribute of the simplices
+       * @returns Indices of the simplices, in increasing order
+       *
+       * The index lists of the mesh are computed once and are kept until
+       * the topology or an attribute is modified. The returned list is
+       * shared, hence it stays valid after such a modification, and may be
+       * requested concurrently from several threads.
+       */
+      virtual IndexList getIndices(size_t dimension, Attribute attr) const = 0;
+
+      /**
+       * @brief Gets the indices of the faces of the boundary elements of
+       * the mesh which lie on its boundary.
+       * @returns Indices of the faces, in the order of the boundary elements
+       * @see getBoundary() const
+       */
+      virtual IndexList getBoundaryIndices() const = 0;
+
+      /**
+       * @brief Gets the indices of the faces of the boundary elements of
+       * the mesh which lie on its boundary and have the given attribute.
+       */
+      virtual IndexList getBoundaryIndices(Attribute attr) const = 0;
+
+      /**
+       * @brief Gets the indices of the faces in the interior of the mesh.
+       * @see isInterface(Index) const
+       */
+      virtual IndexList getInterfaceIndices() const = 0;
+
+      /**
+       * @brief Gets the indices of the faces in the interior of the mesh
+       * which have the given attribute.
+       */
+      virtual IndexList getInterfaceIndices(Attribute attr) const = 0;
+
       virtual size_t getCount(size_t dim) const = 0;
 
       virtual ElementIterator getElement(Index idx = 0) const = 0;
@@ -279,20 +445,181 @@ namespace Rodin::Geometry
       virtual const SimplexTransformation& getSimplexTransformation(
           size_t dimension, Index idx) const = 0;
 
+      /**
+       * @brief Builds the transformations of all the simplices of the given
+       * dimension.
+       *
+       * The transformations are otherwise built on first access. Calling
+       * this beforehand avoids building them from within a parallel
+       * region.
+       */
+      virtual void precomputeTransformations(size_t dimension) const = 0;
+
+      /**
+       * @brief Sums the measures of some simplices of the given dimension
+       * by attribute.
+       * @param[in] dimension Dimension of the simplices
+       * @param[in] indices Indices of the simplices, or null for all the
+       * simplices of the given dimension
+       * @param[in] attributes Attributes by which the measures are summed,
+       * in increasing order. If empty, the measures of all the simplices
+       * are summed together.
+       * @returns Sum of the measures of the simplices of each attribute, in
+       * the order of @p attributes. The simplices of other attributes are
+       * left out.
+       *
+       * The result does not depend on the number of threads.
+       */
+      virtual std::vector<Scalar> getMeasures(
+          size_t dimension, const IndexList& indices,
+          const std::vector<Attribute>& attributes) const = 0;
+
       virtual Attribute getAttribute(size_t dimension, Index index) const = 0;
 
       virtual MeshBase& setAttribute(size_t dimension, Index index, Attribute attr) = 0;
 
+      /**
+       * @brief Gets the simplices whose attribute was set since the
+       * attributes had the given generation.
+       * @param[in] generation Generation of the attributes when they were
+       * last read
+       * @param[out] changes Pairs of dimension and index of the simplices,
+       * in the order in which their attribute was set
+       * @returns False if the changes are not recorded as far back as the
+       * given generation, in which case every simplex must be considered
+       * modified.
+       *
+       * The changes are only meaningful if the topology did not change
+       * since the given generation.
+       */
+      virtual bool getAttributeChanges(
+          size_t generation, std::vector<std::pair<size_t, Index>>& changes) const = 0;
+
       virtual const Connectivity& getConnectivity(size_t d, size_t dp) const = 0;
 
       virtual void flush() = 0;
 
+      /**
+       * @brief Updates the cached transformations of the simplices which
+       * are incident to some vertices, after the vertices were moved.
+       * @param[in] vertices Indices of the vertices which were moved
+       *
+       * The other transformations are kept as they are. This is cheaper
+       * than flush() when only a few vertices moved.
+       */
+      virtual void updateTransformations(const std::vector<Index>& vertices) = 0;
+
       /**
        * @internal
        * @brief Gets the underlying handle for the internal mesh.
        * @returns Constant reference to the underlying mfem::Mesh.
        */
       virtual mfem::Mesh& getHandle() const = 0;
+
+    protected:
+      /**
+       * @brief Constructs a mesh with new generations.
+       */
+      MeshBase();
+
+      /**
+       * @brief Copies the mesh, which gets new generations.
+       */
+      MeshBase(const MeshBase&);
+
+      /**
+       * @brief Moves the mesh, which gets new generations.
+       */
+      MeshBase(MeshBase&&);
+
+      MeshBase& operator=(const MeshBase&);
+
+      MeshBase& operator=(MeshBase&&);
+
+      /**
+       * @brief Marks some data of the mesh as modified, changing its
+       * generation.
+       *
+       * Every method which modifies the mesh must call this.
+       */
+      void modify(Data data);
+
+    private:
+      std::array<size_t, 3> m_generations;
+  };
+
+  /**
+   * @brief Records the generations of the data of a mesh on which some
+   * cached data depends.
+   *
+   * A cache keeps a MeshVersion next to the data it computed from a mesh
+   * and only recomputes it when the version is no longer current:
+   * @code{.cpp}
+   * MeshVersion version({ MeshBase::Data::Topology, MeshBase::Data::Attributes });
+   * // ...
+   * if (!version.isCurrent(mesh))
+   * {
+   *   rebuild(mesh);
+   *   version.update(mesh);
+   * }
+   * @endcode
+   *
+   * The version does not refer to the mesh, so that it remains valid if the
+   * cache is moved along with the mesh. A version is never current before
+   * its first update.
+   */
+  class MeshVersion
+  {
+    public:
+      using Data = MeshBase::Data;
+
+      /**
+       * @brief Constructs a version which depends on the given data.
+       */
+      MeshVersion(std::initializer_list<Data> dependencies)
+        : m_dependencies{}, m_generations{}
+      {
+        for (const Data data : dependencies)
+          m_dependencies[static_cast<size_t>(data)] = true;
+      }
+
+      MeshVersion(const MeshVersion&) = default;
+
+      MeshVersion(MeshVersion&&) = default;
+
+      MeshVersion& operator=(const MeshVersion&) = default;
+
+      MeshVersion& operator=(MeshVersion&&) = default;
+
+      /**
+       * @brief Determines if none of the dependencies were modified since
+       * the last update.
+       */
+      inline
+      bool isCurrent(const MeshBase& mesh) const
+      {
+        for (size_t i = 0; i < m_generations.size(); i++)
+        {
+          if (m_dependencies[i] && m_generations[i] != mesh.getGeneration(static_cast<Data>(i)))
+            return false;
+        }
+        return true;
+      }
+
+      /**
+       * @brief Records the current generations of the dependencies.
+       */
+      inline
+      MeshVersion& update(const MeshBase& mesh)
+      {
+        for (size_t i = 0; i < m_generations.size(); i++)
+          m_generations[i] = mesh.getGeneration(static_cast<Data>(i));
+        return *this;
+      }
+
+    private:
+      std::array<bool, 3> m_dependencies;
+      std::array<size_t, 3> m_generations;
   };
 
   using SerialMesh = Mesh<Context::Serial>;
@@ -322,44 +649,163 @@ namespace Rodin::Geometry
 
           Builder& vertex(std::initializer_list<Scalar> l)
           {
-            Math::Vector x(l.size());
-            std::copy(l.begin(), l.end(), x.begin());
-            return vertex(x);
+            return vertex(l.begin(), l.size());
+          }
+
+          Builder& vertex(const Math::Vector& x)
+          {
+            return vertex(x.data(), x.size());
           }
 
-          Builder& vertex(const Math::Vector& x);
+          /**
+           * @brief Adds vertices whose coordinates are stored one vertex
+           * after the other.
+           * @param[in] coordinates Coordinates of the vertices, of size a
+           * multiple of the space dimension.
+           *
+           * If no vertex was added before, the buffer is moved into the
+           * builder instead of being copied.
+           */
+          Builder& vertices(std::vector<Scalar> coordinates);
 
           Builder& face(Type geom, const Array<Index>& vs,
-              Attribute attr = RODIN_DEFAULT_SIMPLEX_ATTRIBUTE);
+              Attribute attr = RODIN_DEFAULT_SIMPLEX_ATTRIBUTE)
+          {
+            m_faces.add(geom, vs.data(), attr);
+            return *this;
+          }
 
           Builder& element(Type geom, const Array<Index>& vs,
-              Attribute attr = RODIN_DEFAULT_SIMPLEX_ATTRIBUTE);
+              Attribute attr = RODIN_DEFAULT_SIMPLEX_ATTRIBUTE)
+          {
+            m_elements.add(geom, vs.data(), attr);
+            return *this;
+          }
 
           Builder& face(Type geom, std::initializer_list<Index> vs,
               Attribute attr = RODIN_DEFAULT_SIMPLEX_ATTRIBUTE)
           {
-            Array<Index> as(vs.size());
-            std::copy(vs.begin(), vs.end(), as.begin());
-            return face(geom, as, attr);
+            m_faces.add(geom, vs.begin(), attr);
+            return *this;
           }
 
           Builder& element(Type geom, std::initializer_list<Index> vs,
               Attribute attr = RODIN_DEFAULT_SIMPLEX_ATTRIBUTE)
           {
-            Array<Index> as(vs.size());
-            std::copy(vs.begin(), vs.end(), as.begin());
-            return element(geom, as, attr);
+            m_elements.add(geom, vs.begin(), attr);
+            return *this;
           }
 
+          /**
+           * @brief Adds faces of the same geometry.
+           * @param[in] geom Geometry of the faces
+           * @param[in] vs Vertices of the faces, one face after the other
+           * @param[in] attrs Attribute of each face. If empty, the faces
+           * get the default attribute.
+           *
+           * If no face was added before, the buffers are moved into the
+           * builder instead of being copied.
+           */
+          Builder& faces(Type geom, std::vector<Index> vs, std::vector<Attribute> attrs = {})
+          {
+            m_faces.add(geom, std::move(vs), std::move(attrs));
+            return *this;
+          }
+
+          /**
+           * @brief Adds elements of the same geometry.
+           * @see faces(Type, std::vector<Index>, std::vector<Attribute>)
+           */
+          Builder& elements(Type geom, std::vector<Index> vs, std::vector<Attribute> attrs = {})
+          {
+            m_elements.add(geom, std::move(vs), std::move(attrs));
+            return *this;
+          }
+
+          /**
+           * @brief Adds faces of possibly different geometries.
+           * @param[in] geoms Geometry of each face
+           * @param[in] offsets Offsets of the vertices of each face in
+           * @p vs, of size one more than the number of faces and starting
+           * at zero.
+           * @param[in] vs Vertices of the faces, one face after the other
+           * @param[in] attrs Attribute of each face. If empty, the faces
+           * get the default attribute.
+           */
+          Builder& faces(
+              std::vector<Type> geoms, std::vector<size_t> offsets,
+              std::vector<Index> vs, std::vector<Attribute> attrs = {})
+          {
+            m_faces.add(std::move(geoms), std::move(offsets), std::move(vs), std::move(attrs));
+            return *this;
+          }
+
+          /**
+           * @brief Adds elements of possibly different geometries.
+           * @see faces(std::vector<Type>, std::vector<size_t>, std::vector<Index>, std::vector<Attribute>)
+           */
+          Builder& elements(
+              std::vector<Type> geoms, std::vector<size_t> offsets,
+              std::vector<Index> vs, std::vector<Attribute> attrs = {})
+          {
+            m_elements.add(std::move(geoms), std::move(offsets), std::move(vs), std::move(attrs));
+            return *this;
+          }
+
+          /**
+           * @brief Builds the mesh from the vertices, elements and faces
+           * which were added.
+           *
+           * The bulk methods save the temporaries and the copies of the
+           * per-entity ones. Their buffers are moved into the builder, and
+           * the element to vertex buffers are then moved into the
+           * connectivity of the mesh. The mfem::Mesh is allocated with its
+           * final sizes, so each vertex and element is written once into
+           * its arrays. mfem nevertheless needs one mfem::Element per
+           * element and face, which is allocated and filled here for
+           * both kinds of methods.
+           *
+           * @see tests/benchmarks/MeshBuilder.cpp
+           */
           void finalize() override;
 
         private:
+          /**
+           * @internal
+           * @brief Simplices of one dimension in compressed row storage.
+           */
+          struct Entities
+          {
+            Entities()
+              : offsets{0}
+            {}
+
+            size_t size() const
+            {
+              return geometries.size();
+            }
+
+            void add(Type geom, const Index* vs, Attribute attr);
+
+            void add(Type geom, std::vector<Index> vs, std::vector<Attribute> attrs);
+
+            void add(
+                std::vector<Type> geoms, std::vector<size_t> offs,
+                std::vector<Index> vs, std::vector<Attribute> attrs);
+
+            std::vector<Type> geometries;
+            std::vector<size_t> offsets;
+            std::vector<Index> vertices;
+            std::vector<Attribute> attributes;
+          };
+
+          Builder& vertex(const Scalar* x, size_t n);
+
           std::optional<std::reference_wrapper<Mesh<Context::Serial>>> m_ref;
           size_t m_dim, m_sdim;
-          std::vector<size_t> m_count;
-          std::vector<std::vector<Connectivity>> m_connectivity;
-          std::vector<std::vector<std::unique_ptr<SimplexTransformation>>> m_transformations;
-          std::unique_ptr<mfem::Mesh> m_impl;
+          std::vector<Scalar> m_vertices;
+          Entities m_elements;
+          Entities m_faces;
       };
 
       /**
@@ -389,6 +835,7 @@ namespace Rodin::Geometry
           m_f2b(other.m_f2b)
       {
         m_impl.reset(new mfem::Mesh(*other.m_impl));
+        flush();
       }
 
       /**
@@ -426,8 +873,23 @@ namespace Rodin::Geometry
 
       virtual Mesh& scale(Scalar c) override;
 
+      /**
+       * @brief Renumbers the elements of the mesh.
+       * @param[in] ordering New index of each element
+       *
+       * The vertices keep their indices while the faces are renumbered.
+       * Finite element spaces and grid functions built on the mesh are
+       * invalidated.
+       *
+       * @returns Reference to this (for method chaining)
+       */
+      Mesh& reorder(const std::vector<Index>& ordering);
+
       virtual Mesh& setAttribute(size_t dimension, Index index, Attribute attr) override;
 
+      virtual bool getAttributeChanges(
+          size_t generation, std::vector<std::pair<size_t, Index>>& changes) const override;
+
       /**
       * @brief Skins the mesh to obtain its boundary mesh
       * @returns SubMesh object to the boundary region of the mesh
@@ -476,6 +938,16 @@ namespace Rodin::Geometry
 
       virtual FaceIterator getInterface() const override;
 
+      virtual IndexList getIndices(size_t dimension, Attribute attr) const override;
+
+      virtual IndexList getBoundaryIndices() const override;
+
+      virtual IndexList getBoundaryIndices(Attribute attr) const override;
+
+      virtual IndexList getInterfaceIndices() const override;
+
+      virtual IndexList getInterfaceIndices(Attribute attr) const override;
+
       virtual ElementIterator getElement(Index idx = 0) const override;
 
       virtual FaceIterator getFace(Index idx = 0) const override;
@@ -497,9 +969,32 @@ namespace Rodin::Geometry
 
       virtual size_t getSpaceDimension() const override;
 
+      /**
+       * @brief Gets the transformation of a simplex, building it on first
+       * access.
+       *
+       * This method may be called concurrently from several threads. The
+       * mfem handles of the transformations, however, are not safe for
+       * concurrent use.
+       */
       virtual const SimplexTransformation& getSimplexTransformation(
           size_t dimension, Index idx) const override;
 
+      virtual void precomputeTransformations(size_t dimension) const override;
+
+      /**
+       * @brief Sums the measures of some simplices of the given dimension
+       * by attribute.
+       *
+       * The measure of an affine simplex is read from the determinant of
+       * its transformation, while the other simplices are integrated. The
+       * simplices are summed by blocks of consecutive indices into dense
+       * arrays, which are then added in the order of the blocks.
+       */
+      virtual std::vector<Scalar> getMeasures(
+          size_t dimension, const IndexList& indices,
+          const std::vector<Attribute>& attributes) const override;
+
       virtual Attribute getAttribute(size_t dimension, Index index) const override;
 
       virtual const Connectivity& getConnectivity(size_t d, size_t dp) const override
@@ -513,23 +1008,153 @@ namespace Rodin::Geometry
         return m_connectivity[d][dp];
       }
 
-      virtual void flush() override
-      {
-        for (size_t d = 0; d < m_transformations.size(); d++)
-          for (size_t i = 0; i < m_transformations[d].size(); i++)
-            m_transformations[d][i].reset();
-      }
+      /**
+       * @brief Discards the transformations of all the simplices.
+       *
+       * Contrary to getSimplexTransformation(size_t, Index) const, this
+       * method must not be called concurrently with any other method.
+       */
+      virtual void flush() override;
+
+      /**
+       * @brief Updates the cached transformations of the simplices which
+       * are incident to some vertices, after the vertices were moved.
+       *
+       * Only the elements and faces incident to the moved vertices are
+       * visited, using the vertex incidence which is built on first use.
+       * Their transformations are recomputed in place, so that references
+       * to them stay valid. Like flush(), this method must not be called
+       * concurrently with any other method.
+       */
+      virtual void updateTransformations(const std::vector<Index>& vertices) override;
 
       mfem::Mesh& getHandle() const override;
 
     private:
+      /**
+       * @internal
+       * @brief Index lists of the elements and faces, per attribute and per
+       * region.
+       */
+      struct IndexLists
+      {
+        IndexLists()
+          : version({ Data::Topology, Data::Attributes })
+        {}
+
+        MeshVersion version;
+        std::map<Attribute, std::vector<Index>> elements;
+        std::map<Attribute, std::vector<Index>> faces;
+        std::vector<Index> boundary;
+        std::map<Attribute, std::vector<Index>> boundaryByAttribute;
+        std::vector<Index> interface;
+        std::map<Attribute, std::vector<Index>> interfaceByAttribute;
+      };
+
+      /**
+       * @internal
+       * @brief Index lists of the mesh, with the lock which serializes
+       * their computation.
+       *
+       * The lists are never modified once computed: a new set of lists
+       * replaces them, so that the lists handed out before stay alive as
+       * long as they are referenced.
+       */
+      struct IndexListsCache
+      {
+        std::mutex mutex;
+        std::shared_ptr<const IndexLists> lists;
+      };
+
+      /**
+       * @internal
+       * @brief Gets the index lists, computing them if the topology or the
+       * attributes changed since they were last computed.
+       */
+      std::shared_ptr<const IndexLists> getIndexLists() const;
+
+      /**
+       * @internal
+       * @brief Transformations of the simplices of one dimension.
+       *
+       * The affine transformations are all built at once, while the other
+       * ones are built one at a time and published in their own slot with a
+       * compare-and-swap. Both may hence be built concurrently.
+       */
+      struct TransformationCache
+      {
+        TransformationCache(size_t count);
+
+        ~TransformationCache();
+
+        const size_t count;
+        std::once_flag affineFlag;
+        std::vector<AffineTransformation> affine;
+        std::unique_ptr<std::atomic<SimplexTransformation*>[]> simplices;
+      };
+
+      /**
+       * @internal
+       * @brief Gets the affine transformations of all the simplices of the
+       * given dimension, computing them if they are not up to date.
+       * @returns Empty vector if some simplex of the given dimension is not
+       * affine.
+       */
+      const std::vector<AffineTransformation>& getAffineTransformations(size_t dimension) const;
+
+      /**
+       * @internal
+       * @brief Builds the transformation of an affine simplex from the
+       * current coordinates of its vertices.
+       *
+       * The vertices of the simplex are read into the given scratch
+       * buffers, which may be reused across calls.
+       */
+      AffineTransformation createAffineTransformation(
+          size_t dimension, Index idx, mfem::Array<int>& v, Math::Matrix& vertices) const;
+
+      /**
+       * @internal
+       * @brief Gets the simplices of the given dimension incident to each
+       * vertex, building the incidence if the topology changed since it was
+       * last built.
+       */
+      const Connectivity& getVertexIncidence(size_t dimension);
+
+      /**
+       * @internal
+       * @brief Builds the mfem transformation of a simplex which is not
+       * affine.
+       */
+      SimplexTransformation* createSimplexTransformation(size_t dimension, Index idx) const;
+
       size_t m_dim, m_sdim;
       std::vector<size_t> m_count;
       std::vector<std::vector<Connectivity>> m_connectivity;
-      mutable std::vector<std::vector<std::unique_ptr<SimplexTransformation>>> m_transformations;
+      std::vector<std::unique_ptr<TransformationCache>> m_transformations;
 
       std::map<Index, Index> m_f2b;
       std::unique_ptr<mfem::Mesh> m_impl;
+
+      /**
+       * @internal
+       * @brief Simplex whose attribute was set, along with the generation
+       * of the attributes which resulted from it.
+       */
+      struct AttributeChange
+      {
+        size_t generation;
+        size_t dimension;
+        Index index;
+      };
+
+      /// Attribute changes, in increasing order of generation.
+      std::vector<AttributeChange> m_attributeChanges;
+
+      /// Generation of the attributes from which the changes are recorded.
+      size_t m_attributeChangesStart = 0;
+
+      std::unique_ptr<IndexListsCache> m_indexLists = std::make_unique<IndexListsCache>();
   };
 }
 
@@ -22,89 +22,166 @@ namespace Rodin::Geometry
     // Track the object
     m_ref.emplace(std::ref(mesh));
 
-    // Set counts to zero
-    m_count.resize(m_dim + 1, 0);
-
-    // Emplace empty connectivity objects
-    m_connectivity.resize(m_dim + 1);
-    for (size_t i = 0; i < m_connectivity.size(); i++)
-    {
-      m_connectivity[i].reserve(m_connectivity.size());
-      for (size_t j = 0; j < m_connectivity.size(); j++)
-      {
-        m_connectivity[i].push_back(Connectivity(i, j));
-      }
-    }
-
-    // Emplace tranformation vectors
-    m_transformations.resize(m_dim + 1);
-
-    // Emplace the implementation
-    m_impl.reset(new mfem::Mesh(m_dim, 0, 0, 0, m_sdim));
-
     return *this;
   }
 
   Mesh<Context::Serial>::Builder&
-  Mesh<Context::Serial>::Builder::vertex(const Math::Vector& x)
+  Mesh<Context::Serial>::Builder::vertex(const Scalar* x, size_t n)
   {
-    auto sdim = m_impl->SpaceDimension();
-    assert(x.size() >= 0);
-    if (static_cast<decltype(sdim)>(x.size()) != sdim)
+    if (n != m_sdim)
     {
       Alert::Exception()
         << "Vertex dimension is different from space dimension"
-        << " (" << x.size() << " != " << sdim << ")"
+        << " (" << n << " != " << m_sdim << ")"
         << Alert::Raise;
     }
-    m_impl->AddVertex(x.data());
+    m_vertices.insert(m_vertices.end(), x, x + n);
     return *this;
   }
 
   Mesh<Context::Serial>::Builder&
-  Mesh<Context::Serial>::Builder::element(Type geom, const Array<Index>& vs, Attribute attr)
+  Mesh<Context::Serial>::Builder::vertices(std::vector<Scalar> coordinates)
   {
-    assert(m_ref.has_value());
-    const auto& ref = m_ref->get();
-    mfem::Element* el = m_impl->NewElement(static_cast<int>(geom));
-    std::copy_n(vs.begin(), el->GetNVertices(), el->GetVertices());
-    el->SetAttribute(attr);
-    const Index idx = m_impl->AddElement(el);
-    m_connectivity[ref.getDimension()][0].connect(idx, vs);
+    if (coordinates.size() % m_sdim != 0)
+    {
+      Alert::Exception()
+        << "Size of the coordinates is not a multiple of the space dimension"
+        << " (" << coordinates.size() << " % " << m_sdim << " != 0)"
+        << Alert::Raise;
+    }
+    if (m_vertices.empty())
+      m_vertices = std::move(coordinates);
+    else
+      m_vertices.insert(m_vertices.end(), coordinates.begin(), coordinates.end());
     return *this;
   }
 
-  Mesh<Context::Serial>::Builder&
-  Mesh<Context::Serial>::Builder::face(Type geom, const Array<Index>& vs, Attribute attr)
+  void Mesh<Context::Serial>::Builder::Entities::add(Type geom, const Index* vs, Attribute attr)
   {
-    mfem::Element* el = m_impl->NewElement(static_cast<int>(geom));
-    std::copy_n(vs.begin(), el->GetNVertices(), el->GetVertices());
-    el->SetAttribute(attr);
-    m_impl->AddBdrElement(el);
-    return *this;
+    const int nv = mfem::Geometry::NumVerts[static_cast<int>(geom)];
+    geometries.push_back(geom);
+    vertices.insert(vertices.end(), vs, vs + nv);
+    offsets.push_back(vertices.size());
+    attributes.push_back(attr);
   }
 
-  void Mesh<Context::Serial>::Builder::finalize()
+  void Mesh<Context::Serial>::Builder::Entities::add(
+      Type geom, std::vector<Index> vs, std::vector<Attribute> attrs)
   {
-    m_impl->FinalizeTopology();
-    m_impl->Finalize(false, true);
-
-    // TODO: Compute counts of all simplices
-    m_count[m_dim] = m_impl->GetNE();
-    m_count[m_dim - 1] = m_impl->GetNumFaces();
-    m_count[0] = m_impl->GetNV();
+    const size_t nv = mfem::Geometry::NumVerts[static_cast<int>(geom)];
+    assert(vs.size() % nv == 0);
+    const size_t n = vs.size() / nv;
+    assert(attrs.empty() || attrs.size() == n);
+    const size_t first = vertices.size();
+    geometries.resize(geometries.size() + n, geom);
+    offsets.reserve(offsets.size() + n);
+    for (size_t i = 1; i <= n; i++)
+      offsets.push_back(first + i * nv);
+    if (vertices.empty())
+      vertices = std::move(vs);
+    else
+      vertices.insert(vertices.end(), vs.begin(), vs.end());
+    if (attrs.empty())
+      attributes.resize(attributes.size() + n, RODIN_DEFAULT_SIMPLEX_ATTRIBUTE);
+    else if (attributes.empty())
+      attributes = std::move(attrs);
+    else
+      attributes.insert(attributes.end(), attrs.begin(), attrs.end());
+  }
 
-    for (size_t d = 0; d < m_count.size(); d++)
-      m_transformations[d].resize(m_count[d]);
+  void Mesh<Context::Serial>::Builder::Entities::add(
+      std::vector<Type> geoms, std::vector<size_t> offs,
+      std::vector<Index> vs, std::vector<Attribute> attrs)
+  {
+    const size_t n = geoms.size();
+    assert(offs.size() == n + 1);
+    assert(offs.front() == 0);
+    assert(offs.back() == vs.size());
+    assert(attrs.empty() || attrs.size() == n);
+    if (size() == 0)
+    {
+      geometries = std::move(geoms);
+      offsets = std::move(offs);
+      vertices = std::move(vs);
+    }
+    else
+    {
+      const size_t first = vertices.size();
+      geometries.insert(geometries.end(), geoms.begin(), geoms.end());
+      offsets.reserve(offsets.size() + n);
+      for (size_t i = 1; i <= n; i++)
+        offsets.push_back(first + offs[i]);
+      vertices.insert(vertices.end(), vs.begin(), vs.end());
+    }
+    if (attrs.empty())
+      attributes.resize(attributes.size() + n, RODIN_DEFAULT_SIMPLEX_ATTRIBUTE);
+    else if (attributes.empty())
+      attributes = std::move(attrs);
+    else
+      attributes.insert(attributes.end(), attrs.begin(), attrs.end());
+  }
 
+  void Mesh<Context::Serial>::Builder::finalize()
+  {
     assert(m_ref.has_value());
     auto& ref = m_ref->get();
 
-    ref.m_impl = std::move(m_impl);
-    ref.m_count = std::move(m_count);
-    ref.m_connectivity = std::move(m_connectivity);
-    ref.m_transformations = std::move(m_transformations);
+    const size_t nv = m_vertices.size() / m_sdim;
+    const size_t ne = m_elements.size();
+    const size_t nbe = m_faces.size();
+
+    // The arrays of the mesh are allocated once, with their final sizes
+    std::unique_ptr<mfem::Mesh> impl(new mfem::Mesh(m_dim, nv, ne, nbe, m_sdim));
+    for (size_t i = 0; i < nv; i++)
+      impl->AddVertex(m_vertices.data() + i * m_sdim);
+    m_vertices = {};
+
+    std::vector<std::vector<Connectivity>> connectivity(m_dim + 1);
+    for (size_t i = 0; i < connectivity.size(); i++)
+    {
+      connectivity[i].reserve(connectivity.size());
+      for (size_t j = 0; j < connectivity.size(); j++)
+        connectivity[i].push_back(Connectivity(i, j));
+    }
+
+    const auto create =
+      [&](const Entities& entities, size_t i)
+      {
+        mfem::Element* el = impl->NewElement(static_cast<int>(entities.geometries[i]));
+        const size_t begin = entities.offsets[i];
+        assert(entities.offsets[i + 1] - begin == static_cast<size_t>(el->GetNVertices()));
+        std::copy_n(entities.vertices.begin() + begin, el->GetNVertices(), el->GetVertices());
+        el->SetAttribute(entities.attributes[i]);
+        return el;
+      };
+
+    for (size_t i = 0; i < ne; i++)
+      impl->AddElement(create(m_elements, i));
+    // The element to vertex connectivity takes over the storage
+    connectivity[m_dim][0].connect(
+        std::move(m_elements.offsets), std::move(m_elements.vertices));
+    m_elements = {};
+
+    for (size_t i = 0; i < nbe; i++)
+      impl->AddBdrElement(create(m_faces, i));
+    m_faces = {};
+
+    impl->FinalizeTopology();
+    impl->Finalize(false, true);
 
+    // TODO: Compute counts of all simplices
+    std::vector<size_t> count(m_dim + 1, 0);
+    count[m_dim] = impl->GetNE();
+    count[m_dim - 1] = impl->GetNumFaces();
+    count[0] = impl->GetNV();
+
+    ref.m_impl = std::move(impl);
+    ref.m_count = std::move(count);
+    ref.m_connectivity = std::move(connectivity);
+    ref.modify(Data::Topology);
+    ref.flush();
+
+    ref.m_f2b.clear();
     for (int i = 0; i < ref.getHandle().GetNBE(); i++)
       ref.m_f2b[ref.getHandle().GetBdrElementEdgeIndex(i)] = i;
   }
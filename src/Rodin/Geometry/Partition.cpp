@@ -0,0 +1,290 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <deque>
+#include <limits>
+#include <algorithm>
+
+#include "Rodin/Math/Matrix.h"
+
+#include "Mesh.h"
+
+#include "Partition.h"
+
+namespace Rodin::Geometry
+{
+  namespace
+  {
+    /**
+     * Recursive coordinate bisection of the element centroids.
+     */
+    class CoordinateBisection
+    {
+      public:
+        CoordinateBisection(const Mesh<Context::Serial>& mesh, std::vector<size_t>& parts)
+          : m_parts(parts)
+        {
+          const mfem::Mesh& handle = mesh.getHandle();
+          const size_t sdim = mesh.getSpaceDimension();
+          const int ne = handle.GetNE();
+          m_centroids.resize(sdim, ne);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+          for (int i = 0; i < ne; i++)
+          {
+            mfem::Array<int> vertices;
+            handle.GetElementVertices(i, vertices);
+            for (size_t k = 0; k < sdim; k++)
+            {
+              Scalar c = 0;
+              for (int j = 0; j < vertices.Size(); j++)
+                c += handle.GetVertex(vertices[j])[k];
+              m_centroids(k, i) = c / vertices.Size();
+            }
+          }
+        }
+
+        void bisect(
+            std::vector<Index>::iterator begin, std::vector<Index>::iterator end,
+            size_t first, size_t count)
+        {
+          assert(count > 0);
+          if (count == 1)
+          {
+            for (auto it = begin; it != end; ++it)
+              m_parts[*it] = first;
+            return;
+          }
+
+          size_t axis = 0;
+          Scalar extent = -1;
+          for (int k = 0; k < m_centroids.rows(); k++)
+          {
+            Scalar min = std::numeric_limits<Scalar>::max();
+            Scalar max = std::numeric_limits<Scalar>::lowest();
+            for (auto it = begin; it != end; ++it)
+            {
+              min = std::min(min, m_centroids(k, *it));
+              max = std::max(max, m_centroids(k, *it));
+            }
+            if (max - min > extent)
+            {
+              axis = k;
+              extent = max - min;
+            }
+          }
+
+          const size_t left = count / 2;
+          const auto mid = begin + ((end - begin) * left) / count;
+          std::nth_element(begin, mid, end,
+              [&](Index a, Index b)
+              {
+                return m_centroids(axis, a) < m_centroids(axis, b);
+              });
+          bisect(begin, mid, first, left);
+          bisect(mid, end, first + left, count - left);
+        }
+
+      private:
+        std::vector<size_t>& m_parts;
+        Math::Matrix m_centroids;
+    };
+
+    /**
+     * Recursive bisection of the element adjacency graph, by breadth first
+     * search.
+     */
+    class GraphBisection
+    {
+      public:
+        GraphBisection(const Mesh<Context::Serial>& mesh, std::vector<size_t>& parts)
+          : m_parts(parts)
+        {
+          const mfem::Mesh& handle = mesh.getHandle();
+          const size_t ne = handle.GetNE();
+
+          // Element adjacency in compressed row storage
+          std::vector<std::pair<Index, Index>> edges;
+          edges.reserve(2 * handle.GetNumFaces());
+          for (int f = 0; f < handle.GetNumFaces(); f++)
+          {
+            int e1, e2;
+            handle.GetFaceElements(f, &e1, &e2);
+            if (e1 >= 0 && e2 >= 0)
+            {
+              edges.emplace_back(e1, e2);
+              edges.emplace_back(e2, e1);
+            }
+          }
+          std::sort(edges.begin(), edges.end());
+          m_offsets.assign(ne + 1, 0);
+          m_adjacency.reserve(edges.size());
+          for (const auto& [a, b] : edges)
+          {
+            m_offsets[a + 1]++;
+            m_adjacency.push_back(b);
+          }
+          for (size_t i = 0; i < ne; i++)
+            m_offsets[i + 1] += m_offsets[i];
+
+          m_group.assign(ne, 0);
+          m_visited.assign(ne, 0);
+          m_token = 0;
+        }
+
+        void bisect(std::vector<Index>& elements, size_t first, size_t count)
+        {
+          assert(count > 0);
+          if (count == 1)
+          {
+            for (const Index e : elements)
+              m_parts[e] = first;
+            return;
+          }
+
+          // Restrict the searches to the given elements
+          const size_t group = ++m_token;
+          for (const Index e : elements)
+            m_group[e] = group;
+
+          // Two searches give a pseudo-peripheral starting element
+          Index start = search(elements, elements.front()).back();
+          start = search(elements, start).back();
+          const std::vector<Index> order = search(elements, start);
+          assert(order.size() == elements.size());
+
+          const size_t left = count / 2;
+          const size_t mid = (elements.size() * left) / count;
+          std::vector<Index> lhs(order.begin(), order.begin() + mid);
+          std::vector<Index> rhs(order.begin() + mid, order.end());
+          elements.clear();
+          elements.shrink_to_fit();
+          bisect(lhs, first, left);
+          bisect(rhs, first + left, count - left);
+        }
+
+      private:
+        /**
+         * Breadth first search from the given element, restarting from the
+         * next unvisited element of the group when the component is
+         * exhausted.
+         */
+        std::vector<Index> search(const std::vector<Index>& elements, Index start)
+        {
+          const size_t group = m_group[start];
+          const size_t visit = ++m_token;
+          std::vector<Index> res;
+          res.reserve(elements.size());
+          std::deque<Index> queue;
+          auto next = elements.begin();
+          while (res.size() < elements.size())
+          {
+            if (queue.empty())
+            {
+              if (m_visited[start] == visit)
+              {
+                while (m_visited[*next] == visit)
+                  ++next;
+                start = *next;
+              }
+              m_visited[start] = visit;
+              queue.push_back(start);
+            }
+            const Index e = queue.front();
+            queue.pop_front();
+            res.push_back(e);
+            for (size_t k = m_offsets[e]; k < m_offsets[e + 1]; k++)
+            {
+              const Index n = m_adjacency[k];
+              if (m_group[n] == group && m_visited[n] != visit)
+              {
+                m_visited[n] = visit;
+                queue.push_back(n);
+              }
+            }
+          }
+          return res;
+        }
+
+        std::vector<size_t>& m_parts;
+        std::vector<size_t> m_offsets;
+        std::vector<Index> m_adjacency;
+        std::vector<size_t> m_group;
+        std::vector<size_t> m_visited;
+        size_t m_token;
+    };
+  }
+
+  Partition::Partition(const Mesh<Context::Serial>& mesh, size_t count, Method method)
+  {
+    const size_t ne = mesh.getCount(mesh.getDimension());
+    assert(count > 0);
+    assert(count <= ne);
+    m_parts.resize(ne);
+    std::vector<Index> elements(ne);
+    for (size_t i = 0; i < ne; i++)
+      elements[i] = i;
+    switch (method)
+    {
+      case Method::CoordinateBisection:
+      {
+        CoordinateBisection(mesh, m_parts).bisect(elements.begin(), elements.end(), 0, count);
+        break;
+      }
+      case Method::Graph:
+      {
+        GraphBisection(mesh, m_parts).bisect(elements, 0, count);
+        break;
+      }
+    }
+    build(mesh, count);
+  }
+
+  void Partition::build(const Mesh<Context::Serial>& mesh, size_t count)
+  {
+    m_elements.assign(count, {});
+    for (size_t i = 0; i < m_parts.size(); i++)
+      m_elements[m_parts[i]].push_back(i);
+
+    const mfem::Mesh& handle = mesh.getHandle();
+    m_interface.clear();
+    m_interfaces.assign(count, {});
+    for (int f = 0; f < handle.GetNumFaces(); f++)
+    {
+      int e1, e2;
+      handle.GetFaceElements(f, &e1, &e2);
+      if (e1 < 0 || e2 < 0 || m_parts[e1] == m_parts[e2])
+        continue;
+      m_interface.push_back(f);
+      m_interfaces[m_parts[e1]].push_back(f);
+      m_interfaces[m_parts[e2]].push_back(f);
+    }
+  }
+
+  std::vector<Index> Partition::getOrdering() const
+  {
+    std::vector<Index> res(m_parts.size());
+    Index idx = 0;
+    for (const auto& elements : m_elements)
+      for (const Index e : elements)
+        res[e] = idx++;
+    return res;
+  }
+
+  Partition& Partition::reorder(Mesh<Context::Serial>& mesh)
+  {
+    assert(mesh.getCount(mesh.getDimension()) == m_parts.size());
+    const std::vector<Index> ordering = getOrdering();
+    mesh.reorder(ordering);
+    std::vector<size_t> parts(m_parts.size());
+    for (size_t i = 0; i < m_parts.size(); i++)
+      parts[ordering[i]] = m_parts[i];
+    m_parts = std::move(parts);
+    build(mesh, getCount());
+    return *this;
+  }
+}
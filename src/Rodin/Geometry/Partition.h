@@ -0,0 +1,154 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_GEOMETRY_PARTITION_H
+#define RODIN_GEOMETRY_PARTITION_H
+
+#include <vector>
+#include <cassert>
+
+#include "ForwardDecls.h"
+
+namespace Rodin::Geometry
+{
+  /**
+   * @brief Partition of the elements of a mesh into balanced parts.
+   *
+   * Each element belongs to exactly one part and the sizes of the parts
+   * differ by at most one element. The faces shared by two elements of
+   * different parts form the interface of the partition.
+   *
+   * The partition is meant for threaded work on a single mesh, for instance
+   * one part per thread. Calling reorder() renumbers the elements of the
+   * mesh so that each part is a contiguous range of indices, which improves
+   * the locality of the accesses to the mesh and to the degrees of freedom.
+   *
+   * @code{.cpp}
+   * Geometry::Partition partition(mesh, 64, Geometry::Partition::Method::Graph);
+   * partition.reorder(mesh);
+   * @endcode
+   */
+  class Partition
+  {
+    public:
+      enum class Method
+      {
+        /**
+         * Recursive bisection of the element centroids, along the axis of
+         * largest extent.
+         */
+        CoordinateBisection,
+
+        /**
+         * Recursive bisection of the element adjacency graph, growing each
+         * half by a breadth first search from a pseudo-peripheral element.
+         * The interfaces are usually smaller than with CoordinateBisection
+         * on graded or curved domains.
+         */
+        Graph
+      };
+
+      /**
+       * @brief Partitions the elements of the mesh.
+       * @param[in] mesh Mesh to partition
+       * @param[in] count Number of parts, between 1 and the number of
+       * elements
+       * @param[in] method Partitioning method
+       */
+      Partition(
+          const Mesh<Context::Serial>& mesh, size_t count,
+          Method method = Method::CoordinateBisection);
+
+      Partition(const Partition&) = default;
+
+      Partition(Partition&&) = default;
+
+      Partition& operator=(const Partition&) = default;
+
+      Partition& operator=(Partition&&) = default;
+
+      /**
+       * @brief Gets the number of parts.
+       */
+      inline
+      size_t getCount() const
+      {
+        return m_elements.size();
+      }
+
+      /**
+       * @brief Gets the part to which the element belongs.
+       */
+      inline
+      size_t getPart(Index element) const
+      {
+        assert(element < m_parts.size());
+        return m_parts[element];
+      }
+
+      /**
+       * @brief Gets the indices of the elements of the part, in increasing
+       * order.
+       */
+      inline
+      const std::vector<Index>& getElements(size_t part) const
+      {
+        assert(part < m_elements.size());
+        return m_elements[part];
+      }
+
+      /**
+       * @brief Gets the indices of the faces shared by two elements of
+       * different parts.
+       */
+      inline
+      const std::vector<Index>& getInterface() const
+      {
+        return m_interface;
+      }
+
+      /**
+       * @brief Gets the indices of the faces of the interface which belong
+       * to an element of the part.
+       */
+      inline
+      const std::vector<Index>& getInterface(size_t part) const
+      {
+        assert(part < m_interfaces.size());
+        return m_interfaces[part];
+      }
+
+      /**
+       * @brief Gets the new index of each element, such that the parts are
+       * contiguous ranges of indices, in increasing order of part.
+       */
+      std::vector<Index> getOrdering() const;
+
+      /**
+       * @brief Renumbers the elements of the partitioned mesh, so that each
+       * part is a contiguous range of indices.
+       *
+       * The partition is updated accordingly.
+       *
+       * @see Mesh<Context::Serial>::reorder(const std::vector<Index>&)
+       */
+      Partition& reorder(Mesh<Context::Serial>& mesh);
+
+    private:
+      /**
+       * @brief Computes the element lists and the interfaces from the part
+       * of each element.
+       */
+      void build(const Mesh<Context::Serial>& mesh, size_t count);
+
+      std::vector<size_t> m_parts;
+      std::vector<std::vector<Index>> m_elements;
+      std::vector<Index> m_interface;
+      std::vector<std::vector<Index>> m_interfaces;
+  };
+}
+
+#endif
@@ -65,12 +65,12 @@ namespace Rodin::Geometry
 
   Scalar Simplex::getVolume() const
   {
-    mfem::ElementTransformation& trans = getTransformation().getHandle();
+    const SimplexTransformation& trans = getTransformation();
     const Variational::QuadratureRule& qr =
-      Variational::QuadratureRule::get(getGeometry(), trans.OrderJ());
+      Variational::QuadratureRule::get(getGeometry(), trans.getDistortionOrder());
     Scalar volume = 0.0;
     for (size_t i = 0; i < qr.size(); i++)
-      volume += qr.getWeight(i) * trans.Weight();
+      volume += qr.getWeight(i) * trans.distortion(qr.getPoint(i));
     return volume;
   }
 
@@ -122,63 +122,42 @@ namespace Rodin::Geometry
   // ---- Point --------------------------------------------------------------
   Point::Point(const Simplex& simplex, const SimplexTransformation& trans, const Math::Vector& rc)
     : m_simplex(simplex), m_trans(trans), m_rc(rc), m_ip(Variational::Internal::vec2ip(m_rc))
-  {
-    m_trans.get().getHandle().SetIntPoint(&m_ip);
-  }
+  {}
 
-  const Math::Vector& Point::getCoordinates(Coordinates coords) const
+  const Math::SpatialVector& Point::getCoordinates(Coordinates coords) const
   {
     switch (coords)
     {
       case Coordinates::Physical:
       {
         if (!m_pc.has_value())
-        {
-          Math::Vector pc(getSimplex().getMesh().getSpaceDimension());
-          mfem::Vector tmp(pc.data(), pc.size());
-          m_trans.get().getHandle().Transform(m_ip, tmp);
-          m_pc.emplace(std::move(pc));
-        }
+          m_pc.emplace(m_trans.get().transform(m_rc));
         assert(m_pc.has_value());
         return m_pc.value();
       }
       case Coordinates::Reference:
       {
-        return m_rc.get();
+        if (!m_rcs.has_value())
+          m_rcs.emplace(m_rc.get());
+        return m_rcs.value();
       }
     }
 
     return m_pc.value(); // Some compilers complain, so return any value
   }
 
-  const Math::Matrix& Point::getJacobian() const
+  const Math::SpatialMatrix& Point::getJacobian() const
   {
     if (!m_jacobian.has_value())
-    {
-      const size_t rdim = getSimplex().getDimension();
-      const size_t sdim = getSimplex().getMesh().getSpaceDimension();
-      Math::Matrix jacobian(sdim, rdim);
-      mfem::DenseMatrix tmp(jacobian.data(), jacobian.rows(), jacobian.cols());
-      assert(&m_trans.get().getHandle().GetIntPoint() == &m_ip);
-      tmp = m_trans.get().getHandle().Jacobian();
-      m_jacobian.emplace(std::move(jacobian));
-    }
+      m_jacobian.emplace(m_trans.get().jacobian(m_rc));
     assert(m_jacobian.has_value());
     return m_jacobian.value();
   }
 
-  const Math::Matrix& Point::getJacobianInverse() const
+  const Math::SpatialMatrix& Point::getJacobianInverse() const
   {
     if (!m_inverseJacobian.has_value())
-    {
-      const size_t rdim = getSimplex().getDimension();
-      const size_t sdim = getSimplex().getMesh().getSpaceDimension();
-      Math::Matrix inv(rdim, sdim);
-      mfem::DenseMatrix tmp(inv.data(), inv.rows(), inv.cols());
-      assert(&m_trans.get().getHandle().GetIntPoint() == &m_ip);
-      tmp = m_trans.get().getHandle().InverseJacobian();
-      m_inverseJacobian.emplace(std::move(inv));
-    }
+      m_inverseJacobian.emplace(m_trans.get().jacobianInverse(m_rc));
     assert(m_inverseJacobian.has_value());
     return m_inverseJacobian.value();
   }
@@ -186,9 +165,7 @@ namespace Rodin::Geometry
   Scalar Point::getDistortion() const
   {
     if (!m_distortion.has_value())
-    {
-      m_distortion.emplace(m_trans.get().getHandle().Weight());
-    }
+      m_distortion.emplace(m_trans.get().distortion(m_rc));
     assert(m_distortion.has_value());
     return m_distortion.value();
   }
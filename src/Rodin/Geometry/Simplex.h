@@ -99,7 +99,15 @@ namespace Rodin::Geometry
 
       const SimplexTransformation& getTransformation() const;
 
-      // virtual VertexIterator getVertices() const;
+      /**
+       * @brief Gets the indices of the vertices of the simplex, in the local
+       * ordering of the reference element.
+       */
+      inline
+      const std::vector<Index>& getVertices() const
+      {
+        return m_vertices;
+      }
 
       virtual SimplexIterator getAdjacent() const;
 
@@ -301,8 +309,8 @@ namespace Rodin::Geometry
       bool operator<(const Point& p) const
       {
         assert(getDimension() == p.getDimension());
-        const Math::Vector& lhs = getCoordinates(Coordinates::Physical);
-        const Math::Vector& rhs = p.getCoordinates(Coordinates::Physical);
+        const auto& lhs = getCoordinates(Coordinates::Physical);
+        const auto& rhs = p.getCoordinates(Coordinates::Physical);
         for (int i = 0; i < lhs.size() - 1; i++)
         {
           if (lhs(i) < rhs(i))
@@ -331,11 +339,24 @@ namespace Rodin::Geometry
         return m_ip;
       }
 
-      const Math::Vector& getCoordinates(Coordinates coords = Coordinates::Physical) const;
+      const Math::SpatialVector& getCoordinates(Coordinates coords = Coordinates::Physical) const;
+
+      /**
+       * @brief Gets the reference coordinates given on construction.
+       *
+       * Contrary to getCoordinates(Coordinates::Reference), the returned
+       * object is the one given on construction, whose address identifies
+       * the point in the finite element caches.
+       */
+      inline
+      const Math::Vector& getReferenceCoordinates() const
+      {
+        return m_rc.get();
+      }
 
-      const Math::Matrix& getJacobian() const;
+      const Math::SpatialMatrix& getJacobian() const;
 
-      const Math::Matrix& getJacobianInverse() const;
+      const Math::SpatialMatrix& getJacobianInverse() const;
 
       Scalar getDistortion() const;
 
@@ -344,9 +365,10 @@ namespace Rodin::Geometry
       std::reference_wrapper<const SimplexTransformation> m_trans;
       std::reference_wrapper<const Math::Vector> m_rc;
       mfem::IntegrationPoint m_ip;
-      mutable std::optional<const Math::Vector> m_pc;
-      mutable std::optional<const Math::Matrix> m_jacobian;
-      mutable std::optional<const Math::Matrix> m_inverseJacobian;
+      mutable std::optional<const Math::SpatialVector> m_pc;
+      mutable std::optional<const Math::SpatialVector> m_rcs;
+      mutable std::optional<const Math::SpatialMatrix> m_jacobian;
+      mutable std::optional<const Math::SpatialMatrix> m_inverseJacobian;
       mutable std::optional<const Scalar> m_distortion;
   };
 }
@@ -1,3 +1,4 @@
+#include "Rodin/Variational/MFEM.h"
 #include "Rodin/Variational/FiniteElement.h"
 
 #include "Mesh.h"
@@ -6,4 +7,55 @@
 #include "SimplexTransformation.h"
 
 namespace Rodin::Geometry
-{}
+{
+  Math::SpatialVector SimplexTransformation::transform(const Math::Vector& rc) const
+  {
+    mfem::IsoparametricTransformation storage;
+    mfem::ElementTransformation& trans = getHandle(storage);
+    const mfem::IntegrationPoint ip = Variational::Internal::vec2ip(rc);
+    Math::SpatialVector res(trans.GetSpaceDim());
+    mfem::Vector tmp(res.data(), res.size());
+    trans.SetIntPoint(&ip);
+    trans.Transform(ip, tmp);
+    return res;
+  }
+
+  Math::SpatialMatrix SimplexTransformation::jacobian(const Math::Vector& rc) const
+  {
+    mfem::IsoparametricTransformation storage;
+    mfem::ElementTransformation& trans = getHandle(storage);
+    const mfem::IntegrationPoint ip = Variational::Internal::vec2ip(rc);
+    Math::SpatialMatrix res(trans.GetSpaceDim(), trans.GetDimension());
+    mfem::DenseMatrix tmp(res.data(), res.rows(), res.cols());
+    trans.SetIntPoint(&ip);
+    tmp = trans.Jacobian();
+    return res;
+  }
+
+  Math::SpatialMatrix SimplexTransformation::jacobianInverse(const Math::Vector& rc) const
+  {
+    mfem::IsoparametricTransformation storage;
+    mfem::ElementTransformation& trans = getHandle(storage);
+    const mfem::IntegrationPoint ip = Variational::Internal::vec2ip(rc);
+    Math::SpatialMatrix res(trans.GetDimension(), trans.GetSpaceDim());
+    mfem::DenseMatrix tmp(res.data(), res.rows(), res.cols());
+    trans.SetIntPoint(&ip);
+    tmp = trans.InverseJacobian();
+    return res;
+  }
+
+  Scalar SimplexTransformation::distortion(const Math::Vector& rc) const
+  {
+    mfem::IsoparametricTransformation storage;
+    mfem::ElementTransformation& trans = getHandle(storage);
+    const mfem::IntegrationPoint ip = Variational::Internal::vec2ip(rc);
+    trans.SetIntPoint(&ip);
+    return trans.Weight();
+  }
+
+  size_t SimplexTransformation::getDistortionOrder() const
+  {
+    mfem::IsoparametricTransformation storage;
+    return getHandle(storage).OrderW();
+  }
+}
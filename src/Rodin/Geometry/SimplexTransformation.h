@@ -38,38 +38,55 @@ namespace Rodin::Geometry
     public:
       virtual ~SimplexTransformation() = default;
 
-      // /**
-      //  * @brief Performs the transformation, taking reference coordinates into
-      //  * physical coordinates.
-      //  *
-      //  * Given @f$ r \in K @f$, computes the point:
-      //  * @f[
-      //  *    p = x(r)
-      //  * @f]
-      //  * in physical coordinates.
-      //  *
-      //  * @param[in] rc Reference coordinates of the point.
-      //  * @returns Physical coordinates
-      //  */
-      // virtual Math::Vector transform(const Math::Vector& rc) const = 0;
+      /**
+       * @brief Performs the transformation, taking reference coordinates into
+       * physical coordinates.
+       *
+       * Given @f$ r \in K @f$, computes the point:
+       * @f[
+       *    p = x(r)
+       * @f]
+       * in physical coordinates.
+       *
+       * @param[in] rc Reference coordinates of the point.
+       * @returns Physical coordinates
+       */
+      virtual Math::SpatialVector transform(const Math::Vector& rc) const;
 
-      // /**
-      //  * @brief Performs the inverse transformation, taking physical
-      //  * coordinates into reference coordinates.
-      //  *
-      //  * Given @f$ p \in \tau @f$, computes the point:
-      //  * @f[
-      //  *    r = x^{-1}(p)
-      //  * @f]
-      //  * in reference coordinates.
-      //  *
-      //  * @param[in] pc Physical coordinates of the point.
-      //  */
-      // virtual Math::Vector inverse(const Math::Vector& pc) const = 0;
+      /**
+       * @brief Computes the jacobian matrix @f$ \mathbf{J}_x(r) @f$ of the
+       * transformation at the given reference coordinates.
+       */
+      virtual Math::SpatialMatrix jacobian(const Math::Vector& rc) const;
 
-      // virtual Math::Matrix jacobian(const Math::Vector& rc) const = 0;
+      /**
+       * @brief Computes the (pseudo-)inverse of the jacobian matrix at the
+       * given reference coordinates.
+       */
+      virtual Math::SpatialMatrix jacobianInverse(const Math::Vector& rc) const;
 
-      virtual mfem::ElementTransformation& getHandle() const = 0;
+      /**
+       * @brief Computes the distortion @f$ \sqrt{ \det \left(
+       * \mathbf{J}_x(r)^T \mathbf{J}_x(r) \right) } @f$ of the transformation
+       * at the given reference coordinates.
+       */
+      virtual Scalar distortion(const Math::Vector& rc) const;
+
+      /**
+       * @brief Gets the polynomial order of the distortion, as a function of
+       * the reference coordinates.
+       */
+      virtual size_t getDistortionOrder() const;
+
+      /**
+       * @brief Gets a handle to the transformation.
+       * @param[in] storage Transformation owned by the caller, in which the
+       * handle may be built.
+       * @returns Either @p storage or a handle owned by this object. In both
+       * cases it stays valid as long as @p storage and this object do.
+       */
+      virtual mfem::ElementTransformation& getHandle(
+          mfem::IsoparametricTransformation& storage) const = 0;
   };
 }
 
@@ -1,9 +1,26 @@
+#include "Rodin/Configure.h"
+
 #include "SubMesh.h"
 
 #include "Simplex.h"
 
 namespace Rodin::Geometry
 {
+  SubMeshMap::SubMeshMap(std::vector<Index>&& parents, size_t count)
+    : m_parents(std::move(parents)), m_children(count, None)
+  {
+    const size_t n = m_parents.size();
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < n; i++)
+    {
+      assert(m_parents[i] < m_children.size());
+      assert(m_children[m_parents[i]] == None);
+      m_children[m_parents[i]] = i;
+    }
+  }
+
   SubMesh<Context::Serial>::SubMesh(const MeshBase& parent)
     : m_parent(parent)
   {}
@@ -8,15 +8,114 @@
 #define RODIN_MESH_SUBMESH_H
 
 #include <map>
+#include <limits>
+#include <cassert>
+#include <vector>
 #include <optional>
 #include <functional>
-#include <boost/bimap.hpp>
 
 #include "ForwardDecls.h"
 #include "Mesh.h"
 
 namespace Rodin::Geometry
 {
+  /**
+   * @brief Map between the simplices of some dimension of a SubMesh and the
+   * simplices of the parent Mesh.
+   *
+   * The map is stored as two dense arrays: one sized to the SubMesh which
+   * holds the parent index of each simplex, and one sized to the parent
+   * which holds the SubMesh index of each simplex, or SubMeshMap::None if
+   * the simplex is not included. Both lookups are hence constant time.
+   */
+  class SubMeshMap
+  {
+    public:
+      /**
+       * @brief Marks the parent simplices which are not in the SubMesh.
+       */
+      static constexpr Index None = std::numeric_limits<Index>::max();
+
+      SubMeshMap() = default;
+
+      /**
+       * @brief Constructs the map from the parent index of each simplex of
+       * the SubMesh.
+       * @param[in] parents Parent index of each simplex of the SubMesh
+       * @param[in] count Number of simplices of the parent
+       */
+      SubMeshMap(std::vector<Index>&& parents, size_t count);
+
+      SubMeshMap(const SubMeshMap&) = default;
+
+      SubMeshMap(SubMeshMap&&) = default;
+
+      SubMeshMap& operator=(const SubMeshMap&) = default;
+
+      SubMeshMap& operator=(SubMeshMap&&) = default;
+
+      /**
+       * @brief Gets the number of simplices of the SubMesh.
+       */
+      inline
+      size_t size() const
+      {
+        return m_parents.size();
+      }
+
+      /**
+       * @brief Gets the index in the parent of a simplex of the SubMesh.
+       */
+      inline
+      Index getParent(Index child) const
+      {
+        assert(child < m_parents.size());
+        return m_parents[child];
+      }
+
+      /**
+       * @brief Gets the index in the SubMesh of a simplex of the parent.
+       * @returns SubMeshMap::None if the simplex is not in the SubMesh.
+       */
+      inline
+      Index getChild(Index parent) const
+      {
+        assert(parent < m_children.size());
+        return m_children[parent];
+      }
+
+      /**
+       * @brief Determines if the simplex of the parent is in the SubMesh.
+       */
+      inline
+      bool hasChild(Index parent) const
+      {
+        return parent < m_children.size() && m_children[parent] != None;
+      }
+
+      /**
+       * @brief Gets the parent index of each simplex of the SubMesh.
+       */
+      inline
+      const std::vector<Index>& getParents() const
+      {
+        return m_parents;
+      }
+
+      /**
+       * @brief Gets the SubMesh index of each simplex of the parent.
+       */
+      inline
+      const std::vector<Index>& getChildren() const
+      {
+        return m_children;
+      }
+
+    private:
+      std::vector<Index> m_parents;
+      std::vector<Index> m_children;
+  };
+
   /**
    * @brief A SubMesh object represents a subregion of a Mesh object.
    *
@@ -47,7 +146,22 @@ namespace Rodin::Geometry
           Builder& setReference(
               Mesh<Context::Serial>::Builder&& build, SubMesh<Context::Serial>& mesh);
 
-          Builder& include(size_t dim, std::set<Index> indices);
+          /**
+           * @brief Includes simplices of the parent in the SubMesh.
+           * @param[in] dim Dimension of the simplices, which must be the
+           * dimension of the SubMesh
+           * @param[in] indices Indices of the simplices in the parent, each
+           * appearing at most once
+           *
+           * The work is @f$ O(n \log n) @f$ in the number @f$ n @f$ of
+           * included simplices, since their new vertices are sorted by
+           * parent index. If the SubMesh has the same dimension as its
+           * parent, the elements and the boundary faces of the parent are
+           * also visited once, to include the boundary of the SubMesh.
+           */
+          Builder& include(size_t dim, const std::vector<Index>& indices);
+
+          Builder& include(size_t dim, const std::set<Index>& indices);
 
           void finalize() override;
 
@@ -55,9 +169,8 @@ namespace Rodin::Geometry
           std::optional<std::reference_wrapper<SubMesh<Context::Serial>>> m_ref;
 
           std::optional<Mesh<Context::Serial>::Builder> m_mbuild;
-          std::vector<Index> m_sidx;
-
-          std::vector<boost::bimap<Index, Index>> m_s2ps;
+          std::vector<std::vector<Index>> m_s2ps;
+          std::vector<Index> m_p2s0;
       };
 
       SubMesh(const MeshBase& parent);
@@ -70,7 +183,7 @@ namespace Rodin::Geometry
 
       SubMesh& operator=(SubMesh&& other)
       {
-        MeshBase::operator=(std::move(other));
+        Mesh::operator=(std::move(other));
         m_parent = std::move(other.m_parent);
         m_s2ps = std::move(other.m_s2ps);
         return *this;
@@ -86,13 +199,17 @@ namespace Rodin::Geometry
        */
       const MeshBase& getParent() const;
 
-      const boost::bimap<Index, Index>& getSimplexMap(size_t d) const
+      /**
+       * @brief Gets the map between the simplices of dimension @f$ d @f$ of
+       * the SubMesh and those of the parent.
+       */
+      const SubMeshMap& getSimplexMap(size_t d) const
       {
         return m_s2ps.at(d);
       }
 
       // [[deprecated]]
-      const boost::bimap<Index, Index>& getElementMap() const
+      const SubMeshMap& getElementMap() const
       {
         return m_s2ps.at(getDimension());
       }
@@ -101,7 +218,7 @@ namespace Rodin::Geometry
 
     private:
       std::reference_wrapper<const MeshBase> m_parent;
-      std::vector<boost::bimap<Index, Index>> m_s2ps;
+      std::vector<SubMeshMap> m_s2ps;
   };
 }
 
@@ -4,10 +4,66 @@
  *       (See accompanying file LICENSE or copy at
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
+#include <algorithm>
+
+#include "Rodin/Configure.h"
+
 #include "SubMesh.h"
 
 namespace Rodin::Geometry
 {
+  namespace
+  {
+    /**
+     * Reads the geometry, attribute and parent vertices of the given
+     * simplices of the parent, in compressed row storage.
+     */
+    void gather(
+        const MeshBase& parent, size_t dim, const std::vector<Index>& indices,
+        std::vector<Type>& geoms, std::vector<size_t>& offsets,
+        std::vector<Index>& vs, std::vector<Attribute>& attrs)
+    {
+      const mfem::Mesh& handle = parent.getHandle();
+      const bool isElement = (dim == parent.getDimension());
+      assert(isElement || dim + 1 == parent.getDimension());
+      const size_t n = indices.size();
+
+      geoms.resize(n);
+      attrs.resize(n);
+      offsets.resize(n + 1);
+      offsets[0] = 0;
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (size_t i = 0; i < n; i++)
+      {
+        const Index idx = indices[i];
+        geoms[i] = static_cast<Type>(
+            isElement ? handle.GetElementGeometry(idx) : handle.GetFaceGeometry(idx));
+        attrs[i] = parent.getAttribute(dim, idx);
+        offsets[i + 1] = mfem::Geometry::NumVerts[static_cast<int>(geoms[i])];
+      }
+      for (size_t i = 0; i < n; i++)
+        offsets[i + 1] += offsets[i];
+
+      vs.resize(offsets[n]);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (size_t i = 0; i < n; i++)
+      {
+        mfem::Array<int> pvs;
+        if (isElement)
+          handle.GetElementVertices(indices[i], pvs);
+        else
+          handle.GetFaceVertices(indices[i], pvs);
+        assert(static_cast<size_t>(pvs.Size()) == offsets[i + 1] - offsets[i]);
+        for (int j = 0; j < pvs.Size(); j++)
+          vs[offsets[i] + j] = pvs[j];
+      }
+    }
+  }
+
   SubMesh<Context::Serial>::Builder::Builder()
   {}
 
@@ -19,12 +75,18 @@ namespace Rodin::Geometry
     m_mbuild.emplace(std::move(build));
     m_ref.emplace(std::ref(mesh));
     m_s2ps.resize(dim + 1);
-    m_sidx.resize(dim + 1, 0);
+    m_p2s0.assign(mesh.getParent().getCount(0), SubMeshMap::None);
     return *this;
   }
 
   SubMesh<Context::Serial>::Builder&
-  SubMesh<Context::Serial>::Builder::include(size_t dim, std::set<Index> indices)
+  SubMesh<Context::Serial>::Builder::include(size_t dim, const std::set<Index>& indices)
+  {
+    return include(dim, std::vector<Index>(indices.begin(), indices.end()));
+  }
+
+  SubMesh<Context::Serial>::Builder&
+  SubMesh<Context::Serial>::Builder::include(size_t dim, const std::vector<Index>& indices)
   {
     assert(m_ref.has_value());
     auto& ref = m_ref->get();
@@ -33,66 +95,91 @@ namespace Rodin::Geometry
     auto& build = m_mbuild.value();
 
     assert(m_s2ps.size() == ref.getDimension() + 1);
-    const auto& parent = m_ref->get().getParent();
+    const auto& parent = ref.getParent();
+    const mfem::Mesh& handle = parent.getHandle();
+    const size_t sdim = parent.getSpaceDimension();
 
-    if (dim == ref.getDimension())
+    if (dim != ref.getDimension())
     {
-      for (const auto& idx : indices)
-      {
-        auto simplex = parent.getSimplex(dim, idx);
-
-        // Add simplex vertices to the resulting mesh
-        const Array<Index>& pvs =
-          parent.getConnectivity(dim, 0).getIncidence(idx);
-
-        Array<Index> vs(pvs.size());
-        for (Index i = 0; i < static_cast<Index>(vs.size()); i++)
-        {
-          Index pvidx = pvs[i];
-          if (m_s2ps[0].right.count(pvidx) == 0) // Only add vertex if it is not in the map
-          {
-            build.vertex(parent.getVertex(pvidx)->coordinates());
-            vs[i] = m_sidx[0]++;
-            m_s2ps[0].insert({ vs[i], pvidx });
-          }
-          else // Else get the id of the vertex in the submesh
-          {
-            vs[i] = m_s2ps[0].right.at(pvidx);
-          }
-        }
-
-        // Add element with the new vertex ordering
-        build.element(simplex->getGeometry(), vs, simplex->getAttribute());
-        m_s2ps[dim].insert({ m_sidx[dim]++, idx });
-      }
+      assert(false);
+      return *this;
+    }
 
-      if (dim == parent.getDimension()) // We are not in the surface case
+    std::vector<Type> geoms;
+    std::vector<size_t> offsets;
+    std::vector<Index> vs;
+    std::vector<Attribute> attrs;
+    gather(parent, dim, indices, geoms, offsets, vs, attrs);
+
+    // Number the new vertices in increasing order of their parent index, so
+    // that the edges and faces keep the orientation they have in the parent
+    constexpr Index marked = SubMeshMap::None - 1;
+    auto& s2pv = m_s2ps[0];
+    const size_t first = s2pv.size();
+    for (const Index v : vs)
+    {
+      assert(v < m_p2s0.size());
+      if (m_p2s0[v] == SubMeshMap::None)
       {
-        for (auto it = parent.getBoundary(); !it.end(); ++it)
-        {
-          int el1 = -1, el2 = -1;
-          parent.getHandle().GetFaceElements(it->getIndex(), &el1, &el2);
-          if (indices.count(el1) || indices.count(el2))
-          {
-            assert(el1 >= 0 || el2 >= 0);
-            mfem::Array<int> pvs;
-            parent.getHandle().GetFaceVertices(it->getIndex(), pvs);
-            Array<Index> vs(pvs.Size());
-            for (int i = 0; i < pvs.Size(); i++)
-              vs[i] = m_s2ps[0].right.at(pvs[i]);
-            build.face(it->getGeometry(), vs, it->getAttribute());
-            m_sidx[ref.getDimension() - 1]++;
-          }
-        }
+        m_p2s0[v] = marked;
+        s2pv.push_back(v);
       }
     }
-    else if (dim == ref.getDimension() - 1)
+    std::sort(s2pv.begin() + first, s2pv.end());
+    for (size_t i = first; i < s2pv.size(); i++)
+      m_p2s0[s2pv[i]] = i;
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < vs.size(); i++)
+      vs[i] = m_p2s0[vs[i]];
+
+    std::vector<Scalar> coordinates((s2pv.size() - first) * sdim);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = first; i < s2pv.size(); i++)
     {
-      assert(false);
+      const double* x = handle.GetVertex(s2pv[i]);
+      for (size_t k = 0; k < sdim; k++)
+        coordinates[(i - first) * sdim + k] = x[k];
     }
-    else
+    build.vertices(std::move(coordinates));
+
+    auto& s2ps = m_s2ps[dim];
+    s2ps.insert(s2ps.end(), indices.begin(), indices.end());
+    build.elements(std::move(geoms), std::move(offsets), std::move(vs), std::move(attrs));
+
+    if (dim == parent.getDimension()) // We are not in the surface case
     {
-      assert(false);
+      std::vector<char> included(parent.getCount(dim), false);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (size_t i = 0; i < indices.size(); i++)
+        included[indices[i]] = true;
+
+      const IndexList parentBoundary = parent.getBoundaryIndices();
+      std::vector<Index> boundary;
+      for (const Index f : *parentBoundary)
+      {
+        int el1 = -1, el2 = -1;
+        handle.GetFaceElements(f, &el1, &el2);
+        assert(el1 >= 0 || el2 >= 0);
+        if ((el1 >= 0 && included[el1]) || (el2 >= 0 && included[el2]))
+          boundary.push_back(f);
+      }
+
+      gather(parent, dim - 1, boundary, geoms, offsets, vs, attrs);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for (size_t i = 0; i < vs.size(); i++)
+      {
+        assert(m_p2s0[vs[i]] != SubMeshMap::None);
+        vs[i] = m_p2s0[vs[i]];
+      }
+      build.faces(std::move(geoms), std::move(offsets), std::move(vs), std::move(attrs));
     }
     return *this;
   }
@@ -107,6 +194,16 @@ namespace Rodin::Geometry
 
     build.finalize();
 
-    ref.m_s2ps = std::move(m_s2ps);
+    const auto& parent = ref.getParent();
+    ref.m_s2ps.clear();
+    ref.m_s2ps.reserve(m_s2ps.size());
+    for (size_t d = 0; d < m_s2ps.size(); d++)
+    {
+      // The inverse map is only allocated for the recorded dimensions
+      const size_t count = m_s2ps[d].empty() ? 0 : parent.getCount(d);
+      ref.m_s2ps.emplace_back(std::move(m_s2ps[d]), count);
+    }
+    m_s2ps.clear();
+    m_p2s0.clear();
   }
 }
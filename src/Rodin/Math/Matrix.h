@@ -18,6 +18,14 @@ namespace Rodin::Math
 
   template <size_t Rows, size_t Cols>
   using FixedSizeMatrix = Eigen::Matrix<Scalar, Rows, Cols>;
+
+  /**
+   * @brief Matrix whose dimensions are at most the maximal space dimension,
+   * stored inline without any heap allocation.
+   */
+  using SpatialMatrix =
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor,
+      RODIN_MAXIMAL_SPACE_DIMENSION, RODIN_MAXIMAL_SPACE_DIMENSION>;
 }
 
 #endif
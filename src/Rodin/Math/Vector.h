@@ -27,6 +27,13 @@ namespace Rodin::Math
   using Vector16 = FixedSizeVector<16>;
   using Vector32 = FixedSizeVector<32>;
   using Vector128 = FixedSizeVector<128>;
+
+  /**
+   * @brief Vector whose size is at most the maximal space dimension, stored
+   * inline without any heap allocation.
+   */
+  using SpatialVector =
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 1, Eigen::ColMajor, RODIN_MAXIMAL_SPACE_DIMENSION, 1>;
 }
 
 #endif
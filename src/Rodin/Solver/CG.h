@@ -97,6 +97,20 @@ namespace Rodin::Solver
         return *this;
       }
 
+      /**
+       * @brief Sets the preconditioner of the solver.
+       * @param[in] smoother Preconditioner, which must outlive the solver
+       * @returns Reference to self (for method chaining)
+       *
+       * The operator of the system is passed to the preconditioner through
+       * `mfem::Solver::SetOperator()` before each solve.
+       */
+      CG& setPreconditioner(mfem::Solver& smoother)
+      {
+        m_smoother.emplace(std::ref(smoother));
+        return *this;
+      }
+
       virtual
       void solve(OperatorType& A, VectorType& X, VectorType& B)
       const override
@@ -106,6 +120,8 @@ namespace Rodin::Solver
         pcg.SetMaxIter(m_maxIterations);
         pcg.SetRelTol(sqrt(m_rtol));
         pcg.SetAbsTol(sqrt(m_atol));
+        if (m_smoother)
+          pcg.SetPreconditioner(*m_smoother);
         pcg.SetOperator(A);
         pcg.Mult(B, X);
       }
@@ -114,6 +130,7 @@ namespace Rodin::Solver
       int  m_maxIterations;
       bool m_printIterations;
       double m_rtol, m_atol;
+      std::optional<std::reference_wrapper<mfem::Solver>> m_smoother;
   };
 
   /**
@@ -24,6 +24,7 @@
 
 #include "Variational/Component.h"
 #include "Variational/Restriction.h"
+#include "Variational/SubMeshTransfer.h"
 
 #include "Variational/LinearForm.h"
 #include "Variational/BilinearForm.h"
@@ -70,6 +71,7 @@
 #include "Variational/FaceIntegral.h"
 #include "Variational/BoundaryIntegral.h"
 #include "Variational/Problem.h"
+#include "Variational/LinearCombination.h"
 
 #include "Variational/ScalarFunction.h"
 #include "Variational/VectorFunction.h"
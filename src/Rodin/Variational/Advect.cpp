@@ -24,7 +24,7 @@ namespace Rodin::Variational::Internal
       mfem::SparseMatrix& M,
       mfem::SparseMatrix& K,
       const mfem::FiniteElementSpace &fes)
-    : m_M(M), m_K(K),
+    : m_A({ M, K }),
       m_prec(fes.GetFE(0)->GetDof(),
          mfem::BlockILU::Reordering::MINIMUM_DISCARDED_FILL),
       m_dt(-1.0)
@@ -44,12 +44,10 @@ namespace Rodin::Variational::Internal
       m_dt = dt;
 
       // Form operator A = M - dt * K
-      m_A = m_K;
-      m_A *= -m_dt;
-      m_A += m_M;
+      m_A.setCoefficients({ 1.0, -m_dt });
 
       // This will also call SetOperator on the preconditioner
-      m_linearSolver.SetOperator(m_A);
+      m_linearSolver.SetOperator(m_A.getOperator());
     }
   }
 
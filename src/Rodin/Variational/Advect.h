@@ -11,6 +11,7 @@
 
 #include "GridFunction.h"
 #include "ScalarFunction.h"
+#include "LinearCombination.h"
 
 namespace Rodin::Variational::Internal
 {
@@ -25,6 +26,11 @@ namespace Rodin::Variational::Internal
           mfem::SparseMatrix& K,
           const mfem::FiniteElementSpace &fes);
 
+      /**
+       * Sets the time step of the solver, whose operator is then
+       * @f$ M - \Delta t \ K @f$. Only the values of the operator are
+       * recomputed, its sparsity pattern is built once at construction.
+       */
       void SetTimeStep(double dt);
 
       void SetOperator(const Operator &op);
@@ -32,9 +38,7 @@ namespace Rodin::Variational::Internal
       virtual void Mult(const mfem::Vector& x, mfem::Vector& y) const;
 
     private:
-      mfem::SparseMatrix& m_M;
-      mfem::SparseMatrix& m_K;
-      mfem::SparseMatrix m_A;
+      LinearCombination m_A;
       mfem::GMRESSolver m_linearSolver;
       mfem::BlockILU m_prec;
       double m_dt;
@@ -7,6 +7,7 @@
 #ifndef RODIN_VARIATIONAL_ASSEMBLY_H
 #define RODIN_VARIATIONAL_ASSEMBLY_H
 
+#include <memory>
 #include <variant>
 #include <ostream>
 
@@ -44,6 +45,37 @@ namespace Rodin::Variational::Assembly
       virtual AssemblyBase* copy() const noexcept = 0;
   };
 
+  /**
+   * @brief Assembly of bilinear forms whose operator is only known through
+   * its action.
+   *
+   * The type of the returned operator is chosen by the assembly policy,
+   * e.g. a sparse matrix or a matrix-free operator.
+   */
+  template <>
+  class AssemblyBase<BilinearFormBase<mfem::Operator>>
+    : public FormLanguage::Base
+  {
+    public:
+      struct Input
+      {
+        const Geometry::MeshBase& mesh;
+        const FiniteElementSpaceBase& trialFES;
+        const FiniteElementSpaceBase& testFES;
+        const FormLanguage::List<BilinearFormIntegratorBase>& bfis;
+      };
+
+      AssemblyBase() = default;
+
+      AssemblyBase(const AssemblyBase&) = default;
+
+      AssemblyBase(AssemblyBase&&) = default;
+
+      virtual std::unique_ptr<mfem::Operator> execute(const Input& data) const = 0;
+
+      virtual AssemblyBase* copy() const noexcept = 0;
+  };
+
   template <class OperatorType>
   class AssemblyBase<LinearFormBase<OperatorType>>
     : public FormLanguage::Base
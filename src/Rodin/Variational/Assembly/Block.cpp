@@ -0,0 +1,227 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "Native.h"
+#include "Block.h"
+
+namespace Rodin::Variational::Internal
+{
+  // ---- BlockSparseMatrix ---------------------------------------------------
+
+  BlockSparseMatrix::BlockSparseMatrix(
+      size_t nodes, size_t blockSize, mfem::Ordering::Type ordering,
+      std::vector<int>&& rows, std::vector<int>&& cols)
+    : mfem::Operator(nodes * blockSize),
+      m_nodes(nodes),
+      m_blockSize(blockSize),
+      m_ordering(ordering),
+      m_rows(std::move(rows)),
+      m_cols(std::move(cols)),
+      m_blocks(m_cols.size() * blockSize * blockSize, 0.0)
+  {
+    assert(m_rows.size() == nodes + 1);
+    assert(static_cast<size_t>(m_rows.back()) == m_cols.size());
+  }
+
+  int BlockSparseMatrix::find(size_t i, size_t j) const
+  {
+    assert(i < m_nodes);
+    const auto begin = m_cols.begin() + m_rows[i];
+    const auto end = m_cols.begin() + m_rows[i + 1];
+    const auto it = std::lower_bound(begin, end, static_cast<int>(j));
+    if (it == end || *it != static_cast<int>(j))
+      return -1;
+    return it - m_cols.begin();
+  }
+
+  void BlockSparseMatrix::Mult(const mfem::Vector& x, mfem::Vector& y) const
+  {
+    assert(x.Size() == width);
+    assert(y.Size() == height);
+    const size_t b = m_blockSize;
+    y = 0.0;
+    for (size_t i = 0; i < m_nodes; i++)
+    {
+      for (int k = m_rows[i]; k < m_rows[i + 1]; k++)
+      {
+        const size_t j = m_cols[k];
+        const Scalar* block = getBlock(k);
+        for (size_t c = 0; c < b; c++)
+        {
+          const Scalar xj = x(getIndex(j, c));
+          for (size_t r = 0; r < b; r++)
+            y(getIndex(i, r)) += block[r + b * c] * xj;
+        }
+      }
+    }
+  }
+
+  void BlockSparseMatrix::MultTranspose(const mfem::Vector& x, mfem::Vector& y) const
+  {
+    assert(x.Size() == height);
+    assert(y.Size() == width);
+    const size_t b = m_blockSize;
+    y = 0.0;
+    for (size_t i = 0; i < m_nodes; i++)
+    {
+      for (int k = m_rows[i]; k < m_rows[i + 1]; k++)
+      {
+        const size_t j = m_cols[k];
+        const Scalar* block = getBlock(k);
+        for (size_t c = 0; c < b; c++)
+        {
+          Scalar s = 0;
+          for (size_t r = 0; r < b; r++)
+            s += block[r + b * c] * x(getIndex(i, r));
+          y(getIndex(j, c)) += s;
+        }
+      }
+    }
+  }
+
+  // ---- BlockJacobi ---------------------------------------------------------
+
+  BlockJacobi::BlockJacobi(const BlockSparseMatrix& mat)
+    : mfem::Solver(mat.Height()),
+      m_matrix(mat)
+  {
+    setup(mat);
+  }
+
+  void BlockJacobi::SetOperator(const mfem::Operator& op)
+  {
+    assert(op.Height() == height);
+    if (const auto* mat = dynamic_cast<const BlockSparseMatrix*>(&op))
+    {
+      m_matrix = *mat;
+      setup(*mat);
+    }
+  }
+
+  void BlockJacobi::setup(const BlockSparseMatrix& mat)
+  {
+    const size_t b = mat.getBlockSize();
+    m_inverses.resize(mat.getNodeCount());
+    for (size_t i = 0; i < mat.getNodeCount(); i++)
+    {
+      const int k = mat.find(i, i);
+      if (k < 0)
+      {
+        m_inverses[i] = Math::Matrix::Identity(b, b);
+      }
+      else
+      {
+        const Eigen::Map<const Math::Matrix> block(mat.getBlock(k), b, b);
+        m_inverses[i] = block.inverse();
+      }
+    }
+  }
+
+  void BlockJacobi::Mult(const mfem::Vector& x, mfem::Vector& y) const
+  {
+    const auto& mat = m_matrix.get();
+    const size_t b = mat.getBlockSize();
+    Math::Vector xi(b);
+    for (size_t i = 0; i < mat.getNodeCount(); i++)
+    {
+      for (size_t c = 0; c < b; c++)
+        xi(c) = x(mat.getIndex(i, c));
+      const Math::Vector yi = m_inverses[i] * xi;
+      for (size_t r = 0; r < b; r++)
+        y(mat.getIndex(i, r)) = yi(r);
+    }
+  }
+}
+
+namespace Rodin::Variational::Assembly
+{
+  std::unique_ptr<mfem::Operator>
+  Block<BilinearFormBase<mfem::Operator>>
+  ::execute(const Input& input) const
+  {
+    const auto& fes = input.trialFES;
+    const size_t b = fes.getVectorDimension();
+    if (input.trialFES != input.testFES || b == 1)
+      return Native<BilinearFormBase<mfem::Operator>>().execute(input);
+
+    const auto& handle = fes.getHandle();
+    const size_t n = handle.GetNDofs();
+    const auto ordering = handle.GetOrdering();
+
+    // Degrees of freedom of the first component, whose node indices
+    // identify the block rows and columns.
+    const auto getNodes =
+      [&](const mfem::Array<int>& dofs)
+      {
+        assert(dofs.Size() % b == 0);
+        const size_t nd = dofs.Size() / b;
+        std::vector<int> res(nd);
+        for (size_t a = 0; a < nd; a++)
+        {
+          assert(dofs[a] >= 0);
+          res[a] = ordering == mfem::Ordering::byNODES ? dofs[a] : dofs[a] / b;
+        }
+        return res;
+      };
+
+    // Compute the node sparsity pattern
+    std::vector<std::vector<int>> adjacency(n);
+    Internal::traverse(input.mesh, input.bfis,
+        [&](const BilinearFormIntegratorBase&, const Geometry::Simplex& simplex)
+        {
+          const std::vector<int> nodes = getNodes(fes.getDOFs(simplex));
+          for (const int i : nodes)
+            adjacency[i].insert(adjacency[i].end(), nodes.begin(), nodes.end());
+        });
+
+    std::vector<int> rows(n + 1);
+    std::vector<int> cols;
+    rows[0] = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+      auto& row = adjacency[i];
+      std::sort(row.begin(), row.end());
+      row.erase(std::unique(row.begin(), row.end()), row.end());
+      cols.insert(cols.end(), row.begin(), row.end());
+      rows[i + 1] = cols.size();
+      row = std::vector<int>();
+    }
+
+    std::unique_ptr<Internal::BlockSparseMatrix> res(
+        new Internal::BlockSparseMatrix(n, b, ordering, std::move(rows), std::move(cols)));
+
+    // Scatter the element matrices, whose local degrees of freedom are
+    // ordered by components.
+    Internal::traverse(input.mesh, input.bfis,
+        [&](const BilinearFormIntegratorBase& bfi, const Geometry::Simplex& simplex)
+        {
+          const std::vector<int> nodes = getNodes(fes.getDOFs(simplex));
+          const size_t nd = nodes.size();
+          const Math::Matrix mat = bfi.getMatrix(simplex);
+          assert(static_cast<size_t>(mat.rows()) == nd * b);
+          assert(static_cast<size_t>(mat.cols()) == nd * b);
+          for (size_t q = 0; q < nd; q++)
+          {
+            for (size_t p = 0; p < nd; p++)
+            {
+              const int k = res->find(nodes[p], nodes[q]);
+              assert(k >= 0);
+              Scalar* block = res->getBlock(k);
+              for (size_t c = 0; c < b; c++)
+                for (size_t r = 0; r < b; r++)
+                  block[r + b * c] += mat(r * nd + p, c * nd + q);
+            }
+          }
+        });
+
+    return res;
+  }
+}
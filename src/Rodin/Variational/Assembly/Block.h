@@ -0,0 +1,172 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_BLOCK_H
+#define RODIN_ASSEMBLY_BLOCK_H
+
+#include <memory>
+#include <vector>
+
+#include <mfem.hpp>
+
+#include "Rodin/Math/Matrix.h"
+
+#include "AssemblyBase.h"
+
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Sparse matrix of a vector valued space, stored in block
+   * compressed row (BSR) format.
+   *
+   * Each stored entry is the dense @f$ b \times b @f$ block which couples
+   * all the components of two nodes, where @f$ b @f$ is the vector
+   * dimension of the space. Hence a single column index is stored per
+   * block instead of @f$ b^2 @f$ indices.
+   */
+  class BlockSparseMatrix : public mfem::Operator
+  {
+    public:
+      /**
+       * @brief Constructs a zero matrix with the given node sparsity
+       * pattern.
+       * @param[in] nodes Number of nodes
+       * @param[in] blockSize Number of components per node
+       * @param[in] ordering Ordering of the degrees of freedom of the
+       * vectors to which the operator applies
+       * @param[in] rows Row offsets, of size @f$ \text{nodes} + 1 @f$
+       * @param[in] cols Sorted column indices of each row
+       */
+      BlockSparseMatrix(
+          size_t nodes, size_t blockSize, mfem::Ordering::Type ordering,
+          std::vector<int>&& rows, std::vector<int>&& cols);
+
+      void Mult(const mfem::Vector& x, mfem::Vector& y) const override;
+
+      void MultTranspose(const mfem::Vector& x, mfem::Vector& y) const override;
+
+      /**
+       * @brief Gets the position of the block @f$ (i, j) @f$, or -1 if it
+       * is not stored.
+       */
+      int find(size_t i, size_t j) const;
+
+      /**
+       * @brief Gets the block at the given position, stored by columns.
+       */
+      Scalar* getBlock(size_t k)
+      {
+        return m_blocks.data() + k * m_blockSize * m_blockSize;
+      }
+
+      const Scalar* getBlock(size_t k) const
+      {
+        return m_blocks.data() + k * m_blockSize * m_blockSize;
+      }
+
+      size_t getNodeCount() const
+      {
+        return m_nodes;
+      }
+
+      size_t getBlockSize() const
+      {
+        return m_blockSize;
+      }
+
+      /**
+       * @brief Gets the number of stored blocks.
+       */
+      size_t getBlockCount() const
+      {
+        return m_cols.size();
+      }
+
+      /**
+       * @brief Gets the index in a vector of the component of the node.
+       */
+      inline
+      size_t getIndex(size_t node, size_t component) const
+      {
+        return m_ordering == mfem::Ordering::byNODES ?
+          component * m_nodes + node : node * m_blockSize + component;
+      }
+
+    private:
+      size_t m_nodes;
+      size_t m_blockSize;
+      mfem::Ordering::Type m_ordering;
+      std::vector<int> m_rows;
+      std::vector<int> m_cols;
+      std::vector<Scalar> m_blocks;
+  };
+
+  /**
+   * @internal
+   * @brief Block Jacobi smoother of a BlockSparseMatrix, which applies the
+   * inverse of the diagonal blocks.
+   *
+   * It may be set as the preconditioner of Solver::CG. If the operator
+   * passed to SetOperator() is not a BlockSparseMatrix, e.g. when it is
+   * wrapped in an `mfem::ConstrainedOperator`, the diagonal blocks of the
+   * matrix given on construction are kept.
+   */
+  class BlockJacobi : public mfem::Solver
+  {
+    public:
+      BlockJacobi(const BlockSparseMatrix& mat);
+
+      void SetOperator(const mfem::Operator& op) override;
+
+      void Mult(const mfem::Vector& x, mfem::Vector& y) const override;
+
+    private:
+      void setup(const BlockSparseMatrix& mat);
+
+      std::reference_wrapper<const BlockSparseMatrix> m_matrix;
+      std::vector<Math::Matrix> m_inverses;
+  };
+}
+
+namespace Rodin::Variational::Assembly
+{
+  /**
+   * @brief Block assembly of bilinear forms on vector valued spaces.
+   *
+   * If the trial and test spaces coincide and are vector valued, the
+   * element matrices are scattered one node block at a time into an
+   * Internal::BlockSparseMatrix. Otherwise the form is assembled by the
+   * Native policy.
+   */
+  template <>
+  class Block<BilinearFormBase<mfem::Operator>>
+    : public AssemblyBase<BilinearFormBase<mfem::Operator>>
+  {
+    public:
+      using Parent = AssemblyBase<BilinearFormBase<mfem::Operator>>;
+      using OperatorType = mfem::Operator;
+
+      Block() = default;
+
+      Block(const Block& other)
+        : Parent(other)
+      {}
+
+      Block(Block&& other)
+        : Parent(std::move(other))
+      {}
+
+      std::unique_ptr<OperatorType> execute(const Input& input) const override;
+
+      Block* copy() const noexcept override
+      {
+        return new Block(*this);
+      }
+  };
+}
+
+#endif
@@ -0,0 +1,257 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "Rodin/Geometry/Mesh.h"
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "Incremental.h"
+
+namespace Rodin::Variational::Internal
+{
+  namespace
+  {
+    bool contains(
+        const Geometry::MeshBase& mesh, Integrator::Region region, const Geometry::Simplex& simplex)
+    {
+      if (simplex.getDimension() == mesh.getDimension())
+        return region == Integrator::Region::Domain;
+      switch (region)
+      {
+        case Integrator::Region::Domain:
+          return false;
+        case Integrator::Region::Faces:
+          return true;
+        case Integrator::Region::Boundary:
+          return mesh.isBoundary(simplex.getIndex());
+        case Integrator::Region::Interface:
+          return mesh.isInterface(simplex.getIndex());
+      }
+      return false;
+    }
+
+    void add(
+        const IncrementalAssembly::Input& input, const Geometry::Simplex& simplex,
+        const Math::Matrix& mat, mfem::SparseMatrix& res)
+    {
+      const mfem::Array<int>& rows = input.testFES.getDOFs(simplex);
+      const mfem::Array<int>& cols = input.trialFES.getDOFs(simplex);
+      mfem::DenseMatrix mfem;
+      if (mat.size() > 0)
+      {
+        assert(mat.rows() == rows.Size());
+        assert(mat.cols() == cols.Size());
+        mfem.UseExternalData(const_cast<Scalar*>(mat.data()), mat.rows(), mat.cols());
+      }
+      else
+      {
+        mfem.SetSize(rows.Size(), cols.Size());
+        mfem = 0.0;
+      }
+      // Keep the zeros so that the sparsity pattern covers the simplex
+      res.AddSubMatrix(rows, cols, mfem, 0);
+    }
+  }
+
+  bool IncrementalAssembly::isCovered(const Input& input, const Geometry::Simplex& simplex)
+  {
+    for (const auto& bfi : input.bfis)
+    {
+      if (contains(input.mesh, bfi.getRegion(), simplex))
+        return true;
+    }
+    return false;
+  }
+
+  Math::Matrix IncrementalAssembly::compute(const Input& input, const Geometry::Simplex& simplex)
+  {
+    Math::Matrix res;
+    const Geometry::Attribute attr = simplex.getAttribute();
+    for (const auto& bfi : input.bfis)
+    {
+      if (!contains(input.mesh, bfi.getRegion(), simplex))
+        continue;
+      if (bfi.getAttributes().size() > 0 && !bfi.getAttributes().count(attr))
+        continue;
+      if (res.size() == 0)
+        res = bfi.getMatrix(simplex);
+      else
+        res += bfi.getMatrix(simplex);
+    }
+    return res;
+  }
+
+  size_t IncrementalAssembly::count(const Input& input)
+  {
+    const auto& mesh = input.mesh;
+    bool faces = false;
+    for (const auto& bfi : input.bfis)
+      faces = faces || bfi.getRegion() != Integrator::Region::Domain;
+
+    size_t res = 0;
+    for (size_t k = 0; k < 2; k++)
+    {
+      if (k == 1 && !faces)
+        break;
+      for (auto it = mesh.getSimplex(mesh.getDimension() - k, 0); !it.end(); ++it)
+      {
+        if (isCovered(input, *it))
+          res++;
+      }
+    }
+    return res;
+  }
+
+  bool IncrementalAssembly::isCurrent(const Input& input) const
+  {
+    if (!isAssembled() || !m_version.isCurrent(input.mesh))
+      return false;
+    if (m_revisions.size() != input.bfis.size())
+      return false;
+    size_t i = 0;
+    for (const auto& bfi : input.bfis)
+    {
+      if (bfi.getRevision() != m_revisions[i++])
+        return false;
+    }
+    return true;
+  }
+
+  mfem::SparseMatrix IncrementalAssembly::assemble(const Input& input)
+  {
+    clear();
+    const auto& mesh = input.mesh;
+    mfem::SparseMatrix res(input.testFES.getSize(), input.trialFES.getSize());
+
+    bool faces = false;
+    for (const auto& bfi : input.bfis)
+      faces = faces || bfi.getRegion() != Integrator::Region::Domain;
+
+    for (size_t k = 0; k < 2; k++)
+    {
+      if (k == 1 && !faces)
+        break;
+      const size_t d = mesh.getDimension() - k;
+      auto& entries = m_entries[k];
+      entries.resize(mesh.getCount(d));
+      for (auto it = mesh.getSimplex(d, 0); !it.end(); ++it)
+      {
+        const auto& simplex = *it;
+        if (!isCovered(input, simplex))
+          continue;
+        auto& entry = entries[simplex.getIndex()];
+        entry.active = true;
+        entry.attribute = simplex.getAttribute();
+        entry.matrix = compute(input, simplex);
+        add(input, simplex, entry.matrix, res);
+        m_count++;
+      }
+    }
+
+    res.Finalize(0);
+    m_version.update(mesh);
+    m_attributes = mesh.getGeneration(Geometry::MeshBase::Data::Attributes);
+    m_revisions.reserve(input.bfis.size());
+    for (const auto& bfi : input.bfis)
+      m_revisions.push_back(bfi.getRevision());
+    m_dimension = mesh.getDimension();
+    return res;
+  }
+
+  void IncrementalAssembly::invalidate(size_t dimension, Index index)
+  {
+    // Every simplex is computed on the next full assembly
+    if (!isAssembled())
+      return;
+    assert(dimension == m_dimension || dimension + 1 == m_dimension);
+    m_dirty[m_dimension - dimension].insert(index);
+  }
+
+  size_t IncrementalAssembly::update(const Input& input, mfem::SparseMatrix& mat)
+  {
+    assert(isCurrent(input));
+    assert(input.mesh.getDimension() == m_dimension);
+    assert(mat.Finalized());
+    const auto& mesh = input.mesh;
+
+    // Collect the simplices whose attribute changed, from the record of
+    // the mesh unless it does not go back far enough
+    const size_t attributes = mesh.getGeneration(Geometry::MeshBase::Data::Attributes);
+    if (attributes != m_attributes)
+    {
+      auto mark = [&](size_t k, Index i)
+      {
+        const auto& entries = m_entries[k];
+        if (i < entries.size() && entries[i].active
+            && entries[i].attribute != mesh.getAttribute(m_dimension - k, i))
+          m_dirty[k].insert(i);
+      };
+
+      std::vector<std::pair<size_t, Index>> changes;
+      if (mesh.getAttributeChanges(m_attributes, changes))
+      {
+        for (const auto& [d, i] : changes)
+        {
+          assert(d == m_dimension || d + 1 == m_dimension);
+          mark(m_dimension - d, i);
+        }
+      }
+      else
+      {
+        for (size_t k = 0; k < 2; k++)
+        {
+          for (size_t i = 0; i < m_entries[k].size(); i++)
+            mark(k, i);
+        }
+      }
+      m_attributes = attributes;
+    }
+
+    size_t res = 0;
+    for (size_t k = 0; k < 2; k++)
+    {
+      const size_t d = m_dimension - k;
+      auto& entries = m_entries[k];
+      auto& dirty = m_dirty[k];
+      for (const Index i : dirty)
+      {
+        assert(i < entries.size());
+        auto& entry = entries[i];
+        if (!entry.active)
+          continue;
+        auto it = mesh.getSimplex(d, i);
+        const auto& simplex = *it;
+        Math::Matrix matrix = compute(input, simplex);
+        Math::Matrix delta;
+        if (entry.matrix.size() == 0)
+          delta = matrix;
+        else if (matrix.size() == 0)
+          delta = -entry.matrix;
+        else
+          delta = matrix - entry.matrix;
+        if (delta.size() > 0)
+          add(input, simplex, delta, mat);
+        entry.attribute = simplex.getAttribute();
+        entry.matrix = std::move(matrix);
+        res++;
+      }
+      dirty.clear();
+    }
+    return res;
+  }
+
+  void IncrementalAssembly::clear()
+  {
+    m_attributes = 0;
+    m_revisions.clear();
+    m_count = 0;
+    m_dimension = 0;
+    for (auto& entries : m_entries)
+      entries.clear();
+    for (auto& dirty : m_dirty)
+      dirty.clear();
+  }
+}
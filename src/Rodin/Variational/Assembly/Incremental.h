@@ -0,0 +1,152 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_INCREMENTAL_H
+#define RODIN_ASSEMBLY_INCREMENTAL_H
+
+#include <set>
+#include <array>
+#include <vector>
+
+#include <mfem.hpp>
+
+#include "Rodin/Math/Matrix.h"
+#include "Rodin/Geometry/Mesh.h"
+
+#include "AssemblyBase.h"
+
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Assembly of a sparse matrix which records the contribution of
+   * each simplex, so that it can be updated for a subset of the simplices.
+   *
+   * The sparsity pattern of the assembled matrix contains the coupling of
+   * the degrees of freedom of every simplex in the region of some
+   * integrator, even if no integrator contributes to it because of its
+   * attribute. A simplex may then be reassembled in place by adding the
+   * difference between its new and its stale contribution.
+   *
+   * The contributions are only kept as long as the geometry and the
+   * topology of the mesh and the revisions of the integrators do not
+   * change. The simplices whose attribute changed are read from the
+   * record of the mesh.
+   */
+  class IncrementalAssembly
+  {
+    public:
+      using Input = Assembly::AssemblyBase<BilinearFormBase<mfem::SparseMatrix>>::Input;
+
+      IncrementalAssembly()
+        : m_version({ Geometry::MeshBase::Data::Geometry, Geometry::MeshBase::Data::Topology })
+      {}
+
+      IncrementalAssembly(const IncrementalAssembly&) = default;
+
+      IncrementalAssembly(IncrementalAssembly&&) = default;
+
+      /**
+       * @brief Assembles the matrix and records the contribution of each
+       * simplex.
+       *
+       * The returned matrix is finalized and keeps its zero entries.
+       */
+      mfem::SparseMatrix assemble(const Input& input);
+
+      /**
+       * @brief Marks the simplex for reassembly.
+       */
+      void invalidate(size_t dimension, Index index);
+
+      /**
+       * @brief Reassembles the invalidated simplices and the simplices whose
+       * attribute changed since they were last assembled.
+       * @param[in] input Same assembly input as the one passed to
+       * assemble(const Input&)
+       * @param[in,out] mat Matrix returned by assemble(const Input&)
+       * @returns Number of simplices which were reassembled
+       *
+       * The recorded contributions must be current.
+       * @see isCurrent(const Input&) const
+       */
+      size_t update(const Input& input, mfem::SparseMatrix& mat);
+
+      /**
+       * @brief Indicates whether some contributions have been recorded.
+       */
+      bool isAssembled() const
+      {
+        return m_revisions.size() > 0;
+      }
+
+      /**
+       * @brief Determines if the recorded contributions may be updated for
+       * the given input, i.e. neither the geometry nor the topology of the
+       * mesh, nor the integrators, changed since they were computed.
+       */
+      bool isCurrent(const Input& input) const;
+
+      /**
+       * @brief Gets the number of simplices whose contribution is recorded.
+       */
+      size_t getCount() const
+      {
+        return m_count;
+      }
+
+      /**
+       * @brief Counts the simplices to which the integrators of the input
+       * contribute, i.e. the simplices which a full assembly traverses.
+       */
+      static size_t count(const Input& input);
+
+      void clear();
+
+    private:
+      /// Contribution of a simplex to the matrix.
+      struct Entry
+      {
+        bool active = false;
+        Geometry::Attribute attribute = 0;
+
+        /// Empty if no integrator contributes to the simplex.
+        Math::Matrix matrix;
+      };
+
+      /**
+       * Computes the contribution of the simplex, adding the integrators of
+       * the given region which apply to its attribute.
+       */
+      static Math::Matrix compute(const Input& input, const Geometry::Simplex& simplex);
+
+      /**
+       * Determines if some integrator may contribute to the simplex,
+       * regardless of its attribute.
+       */
+      static bool isCovered(const Input& input, const Geometry::Simplex& simplex);
+
+      /// Version of the mesh with which the contributions were computed.
+      Geometry::MeshVersion m_version;
+
+      /// Generation of the attributes when they were last read.
+      size_t m_attributes = 0;
+
+      /// Revisions of the integrators with which the contributions were computed.
+      std::vector<size_t> m_revisions;
+
+      size_t m_count = 0;
+      size_t m_dimension = 0;
+
+      /// Entries of the elements and faces, respectively.
+      std::array<std::vector<Entry>, 2> m_entries;
+
+      /// Explicitly invalidated elements and faces, respectively.
+      std::array<std::set<Index>, 2> m_dirty;
+  };
+}
+
+#endif
@@ -0,0 +1,385 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <map>
+#include <cmath>
+
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "Split.h"
+#include "MatrixFree.h"
+
+namespace Rodin::Variational::Internal
+{
+  // ---- MatrixFreeOperator --------------------------------------------------
+
+  bool MatrixFreeOperator::isSupported(const FiniteElementSpaceBase& fes)
+  {
+    if (!dynamic_cast<const mfem::H1_FECollection*>(fes.getHandle().FEColl()))
+      return false;
+    const auto& mesh = fes.getMesh();
+    if (mesh.getDimension() != mesh.getSpaceDimension())
+      return false;
+    const auto& handle = fes.getHandle();
+    if (handle.GetNE() == 0)
+      return false;
+    const auto geometry = mesh.getHandle().GetElementBaseGeometry(0);
+    const int order = handle.GetElementOrder(0);
+    for (int i = 1; i < handle.GetNE(); i++)
+    {
+      if (mesh.getHandle().GetElementBaseGeometry(i) != geometry)
+        return false;
+      if (handle.GetElementOrder(i) != order)
+        return false;
+    }
+    return true;
+  }
+
+  MatrixFreeOperator::MatrixFreeOperator(
+      const FiniteElementSpaceBase& fes, Scalar mass, Scalar diffusion,
+      const std::optional<size_t>& order)
+    : mfem::Operator(fes.getSize()),
+      m_mass(mass),
+      m_diffusion(diffusion)
+  {
+    assert(isSupported(fes));
+    const auto& handle = fes.getHandle();
+    auto& mesh = fes.getMesh().getHandle();
+    m_dimension = mesh.Dimension();
+    m_vdim = handle.GetVDim();
+    m_elements = handle.GetNE();
+
+    const mfem::FiniteElement& fe = *handle.GetFE(0);
+    m_dofs = fe.GetDof();
+
+    mfem::IsoparametricTransformation trans;
+    mesh.GetElementTransformation(0, &trans);
+    const size_t q = order.value_or(2 * fe.GetOrder() + trans.OrderW());
+
+    m_tensor = dynamic_cast<const mfem::TensorBasisElement*>(&fe) != nullptr;
+    const std::vector<mfem::IntegrationPoint> ips =
+      m_tensor ? setupTensor(fe, q) : setupGeneric(fe, q);
+    m_points = ips.size();
+
+    m_vdofs.resize(m_elements * m_vdim * m_dofs);
+    mfem::Array<int> vdofs;
+    for (size_t e = 0; e < m_elements; e++)
+    {
+      handle.GetElementVDofs(e, vdofs);
+      assert(static_cast<size_t>(vdofs.Size()) == m_vdim * m_dofs);
+      std::copy(vdofs.begin(), vdofs.end(), m_vdofs.begin() + e * m_vdim * m_dofs);
+    }
+
+    const size_t d = m_dimension;
+    m_massFactors.resize(m_points, m_elements);
+    m_diffusionFactors.resize(d * d * m_points, m_elements);
+    mfem::DenseMatrix adj(d, d);
+    for (size_t e = 0; e < m_elements; e++)
+    {
+      mesh.GetElementTransformation(e, &trans);
+      for (size_t q = 0; q < m_points; q++)
+      {
+        trans.SetIntPoint(&ips[q]);
+        const Scalar w = ips[q].weight;
+        const Scalar det = std::abs(trans.Weight());
+        m_massFactors(q, e) = m_mass * w * det;
+
+        // w |J| J^{-1} J^{-T} = w adj(J) adj(J)^T / |J|
+        mfem::CalcAdjugate(trans.Jacobian(), adj);
+        for (size_t j = 0; j < d; j++)
+        {
+          for (size_t i = 0; i < d; i++)
+          {
+            Scalar s = 0;
+            for (size_t k = 0; k < d; k++)
+              s += adj(i, k) * adj(j, k);
+            m_diffusionFactors(q * d * d + i + d * j, e) = m_diffusion * w * s / det;
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<mfem::IntegrationPoint>
+  MatrixFreeOperator::setupTensor(const mfem::FiniteElement& fe, size_t order)
+  {
+    const auto& tfe = dynamic_cast<const mfem::TensorBasisElement&>(fe);
+    const mfem::Array<int>& dofMap = tfe.GetDofMap();
+    m_lexicographic.resize(m_dofs);
+    for (size_t i = 0; i < m_dofs; i++)
+      m_lexicographic[i] = dofMap.Size() > 0 ? dofMap[i] : i;
+
+    const auto& basis = tfe.GetBasis1D();
+    const size_t n = fe.GetOrder() + 1;
+    const mfem::IntegrationRule& ir = mfem::IntRules.Get(mfem::Geometry::SEGMENT, order);
+    const size_t nq = ir.GetNPoints();
+    m_basis1D.resize(nq, n);
+    m_gradient1D.resize(nq, n);
+    mfem::Vector u(n), du(n);
+    for (size_t q = 0; q < nq; q++)
+    {
+      basis.Eval(ir.IntPoint(q).x, u, du);
+      for (size_t i = 0; i < n; i++)
+      {
+        m_basis1D(q, i) = u(i);
+        m_gradient1D(q, i) = du(i);
+      }
+    }
+    m_basis1DT = m_basis1D.transpose();
+    m_gradient1DT = m_gradient1D.transpose();
+
+    // Quadrature points in lexicographic order, the first axis running the
+    // fastest, as produced by tensorProduct().
+    const size_t nz = m_dimension > 2 ? nq : 1;
+    const size_t ny = m_dimension > 1 ? nq : 1;
+    std::vector<mfem::IntegrationPoint> res;
+    res.reserve(nq * ny * nz);
+    for (size_t k = 0; k < nz; k++)
+    {
+      for (size_t j = 0; j < ny; j++)
+      {
+        for (size_t i = 0; i < nq; i++)
+        {
+          mfem::IntegrationPoint ip;
+          ip.x = ir.IntPoint(i).x;
+          ip.y = m_dimension > 1 ? ir.IntPoint(j).x : 0.0;
+          ip.z = m_dimension > 2 ? ir.IntPoint(k).x : 0.0;
+          ip.weight = ir.IntPoint(i).weight;
+          if (m_dimension > 1)
+            ip.weight *= ir.IntPoint(j).weight;
+          if (m_dimension > 2)
+            ip.weight *= ir.IntPoint(k).weight;
+          res.push_back(ip);
+        }
+      }
+    }
+    return res;
+  }
+
+  std::vector<mfem::IntegrationPoint>
+  MatrixFreeOperator::setupGeneric(const mfem::FiniteElement& fe, size_t order)
+  {
+    const size_t d = m_dimension;
+    const mfem::IntegrationRule& ir = mfem::IntRules.Get(fe.GetGeomType(), order);
+    const size_t nq = ir.GetNPoints();
+    m_basis.resize(nq, m_dofs);
+    m_gradient.resize(d * nq, m_dofs);
+    mfem::Vector shape(m_dofs);
+    mfem::DenseMatrix dshape(m_dofs, d);
+    std::vector<mfem::IntegrationPoint> res;
+    res.reserve(nq);
+    for (size_t q = 0; q < nq; q++)
+    {
+      const mfem::IntegrationPoint& ip = ir.IntPoint(q);
+      fe.CalcShape(ip, shape);
+      fe.CalcDShape(ip, dshape);
+      for (size_t i = 0; i < m_dofs; i++)
+      {
+        m_basis(q, i) = shape(i);
+        for (size_t k = 0; k < d; k++)
+          m_gradient(q * d + k, i) = dshape(i, k);
+      }
+      res.push_back(ip);
+    }
+    return res;
+  }
+
+  void MatrixFreeOperator::Mult(const mfem::Vector& x, mfem::Vector& y) const
+  {
+    y = 0.0;
+    Math::Vector xe(m_dofs), ye(m_dofs);
+    for (size_t e = 0; e < m_elements; e++)
+    {
+      for (size_t c = 0; c < m_vdim; c++)
+      {
+        const int* vdofs = m_vdofs.data() + (e * m_vdim + c) * m_dofs;
+        for (size_t i = 0; i < m_dofs; i++)
+        {
+          const int k = vdofs[i];
+          xe(i) = k >= 0 ? x(k) : -x(-1 - k);
+        }
+
+        if (m_tensor)
+          applyTensor(xe, ye, e);
+        else
+          applyGeneric(xe, ye, e);
+
+        for (size_t i = 0; i < m_dofs; i++)
+        {
+          const int k = vdofs[i];
+          if (k >= 0)
+            y(k) += ye(i);
+          else
+            y(-1 - k) -= ye(i);
+        }
+      }
+    }
+  }
+
+  void MatrixFreeOperator::applyGeneric(const Math::Vector& x, Math::Vector& y, size_t e) const
+  {
+    const size_t d = m_dimension;
+    y.setZero();
+    if (m_mass != 0.0)
+    {
+      Math::Vector u = m_basis * x;
+      u.array() *= m_massFactors.col(e).array();
+      y.noalias() += m_basis.transpose() * u;
+    }
+    if (m_diffusion != 0.0)
+    {
+      Math::Vector g = m_gradient * x;
+      for (size_t q = 0; q < m_points; q++)
+      {
+        const Eigen::Map<const Math::Matrix> metric(
+            m_diffusionFactors.col(e).data() + q * d * d, d, d);
+        const Math::Vector gq = g.segment(q * d, d);
+        g.segment(q * d, d).noalias() = metric * gq;
+      }
+      y.noalias() += m_gradient.transpose() * g;
+    }
+  }
+
+  void MatrixFreeOperator::applyTensor(const Math::Vector& xe, Math::Vector& ye, size_t e) const
+  {
+    const size_t d = m_dimension;
+    Math::Vector x(m_dofs);
+    for (size_t i = 0; i < m_dofs; i++)
+      x(i) = xe(m_lexicographic[i]);
+
+    Math::Vector y = Math::Vector::Zero(m_dofs);
+    Math::Vector tmp;
+    const Math::Matrix* b = &m_basis1D;
+    const Math::Matrix* bt = &m_basis1DT;
+    if (m_mass != 0.0)
+    {
+      Math::Vector u;
+      tensorProduct({ b, b, b }, x, u);
+      u.array() *= m_massFactors.col(e).array();
+      tensorProduct({ bt, bt, bt }, u, tmp);
+      y += tmp;
+    }
+    if (m_diffusion != 0.0)
+    {
+      std::array<Math::Vector, 3> g;
+      for (size_t k = 0; k < d; k++)
+      {
+        std::array<const Math::Matrix*, 3> a = { b, b, b };
+        a[k] = &m_gradient1D;
+        tensorProduct(a, x, g[k]);
+      }
+      Math::Vector gq(d);
+      for (size_t q = 0; q < m_points; q++)
+      {
+        const Eigen::Map<const Math::Matrix> metric(
+            m_diffusionFactors.col(e).data() + q * d * d, d, d);
+        for (size_t k = 0; k < d; k++)
+          gq(k) = g[k](q);
+        const Math::Vector tq = metric * gq;
+        for (size_t k = 0; k < d; k++)
+          g[k](q) = tq(k);
+      }
+      for (size_t k = 0; k < d; k++)
+      {
+        std::array<const Math::Matrix*, 3> a = { bt, bt, bt };
+        a[k] = &m_gradient1DT;
+        tensorProduct(a, g[k], tmp);
+        y += tmp;
+      }
+    }
+
+    for (size_t i = 0; i < m_dofs; i++)
+      ye(m_lexicographic[i]) = y(i);
+  }
+
+  void MatrixFreeOperator::tensorProduct(
+      const std::array<const Math::Matrix*, 3>& a, const Math::Vector& x, Math::Vector& y) const
+  {
+    Shape shape = { 1, 1, 1 };
+    for (size_t k = 0; k < m_dimension; k++)
+      shape[k] = a[k]->cols();
+    assert(static_cast<size_t>(x.size()) == shape[0] * shape[1] * shape[2]);
+    Math::Vector src = x;
+    for (size_t k = 0; k < m_dimension; k++)
+    {
+      Shape next = shape;
+      next[k] = a[k]->rows();
+      y.resize(next[0] * next[1] * next[2]);
+      contract(*a[k], src.data(), shape, k, y.data());
+      if (k + 1 < m_dimension)
+        src.swap(y);
+    }
+  }
+
+  void MatrixFreeOperator::contract(
+      const Math::Matrix& a, const Scalar* x, Shape& shape, size_t axis, Scalar* y)
+  {
+    assert(shape[axis] == static_cast<size_t>(a.cols()));
+    size_t inner = 1;
+    for (size_t k = 0; k < axis; k++)
+      inner *= shape[k];
+    size_t outer = 1;
+    for (size_t k = axis + 1; k < shape.size(); k++)
+      outer *= shape[k];
+    const size_t rows = a.rows();
+    const size_t cols = a.cols();
+    for (size_t o = 0; o < outer; o++)
+    {
+      for (size_t r = 0; r < rows; r++)
+      {
+        for (size_t i = 0; i < inner; i++)
+        {
+          Scalar s = 0;
+          for (size_t c = 0; c < cols; c++)
+            s += a(r, c) * x[i + inner * (c + cols * o)];
+          y[i + inner * (r + rows * o)] = s;
+        }
+      }
+    }
+    shape[axis] = rows;
+  }
+}
+
+namespace Rodin::Variational::Assembly
+{
+  std::unique_ptr<mfem::Operator>
+  MatrixFree<BilinearFormBase<mfem::Operator>>
+  ::execute(const Input& input) const
+  {
+    const bool supported =
+      input.trialFES == input.testFES && Internal::MatrixFreeOperator::isSupported(input.trialFES);
+    return Internal::split(input,
+        [&](const BilinearFormIntegratorBase& bfi)
+        {
+          return supported && Internal::isMassOrDiffusion(bfi);
+        },
+        [&](const FormLanguage::List<BilinearFormIntegratorBase>& bfis)
+        {
+          // The forms which share a quadrature order share an operator
+          std::map<std::optional<size_t>, std::pair<Scalar, Scalar>> coefficients;
+          for (const auto& bfi : bfis)
+          {
+            const auto form = bfi.getStandardForm();
+            auto& [mass, diffusion] = coefficients[bfi.getQuadratureOrder()];
+            if (form->type == BilinearFormIntegratorBase::StandardForm::Type::Mass)
+              mass += form->coefficient;
+            else
+              diffusion += form->coefficient;
+          }
+          std::vector<std::unique_ptr<mfem::Operator>> operators;
+          for (const auto& [order, c] : coefficients)
+          {
+            operators.emplace_back(
+                new Internal::MatrixFreeOperator(input.trialFES, c.first, c.second, order));
+          }
+          if (operators.size() == 1)
+            return std::move(operators.front());
+          return std::unique_ptr<mfem::Operator>(
+              new Internal::OperatorSum(std::move(operators)));
+        });
+  }
+}
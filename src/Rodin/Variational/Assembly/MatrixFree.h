@@ -0,0 +1,167 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_MATRIXFREE_H
+#define RODIN_ASSEMBLY_MATRIXFREE_H
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <optional>
+
+#include <mfem.hpp>
+
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/Matrix.h"
+
+#include "AssemblyBase.h"
+
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Matrix-free application of the operator
+   * @f[
+   *   \int_\Omega \alpha \, u \cdot v + \beta \, \nabla u : \nabla v \ dx
+   * @f]
+   * on an H1 space.
+   *
+   * The action @f$ y = A x @f$ is computed element by element from the
+   * geometric factors at the quadrature points, which are computed once, and
+   * from tables of the reference basis functions and their gradients. On
+   * `Square` and `Cube` elements the reference element is a tensor product,
+   * so the basis is evaluated one direction at a time (sum factorization)
+   * reducing the cost per element from @f$ \mathcal{O}(p^{2d}) @f$ to
+   * @f$ \mathcal{O}(d \, p^{d + 1}) @f$. Vector valued spaces are handled
+   * component by component.
+   */
+  class MatrixFreeOperator : public mfem::Operator
+  {
+    public:
+      /**
+       * @brief Determines if the operator can be built on the given space.
+       *
+       * The space must be an H1 space over a mesh with a single element
+       * geometry and a uniform order, and the mesh dimension must be equal to
+       * the space dimension.
+       */
+      static bool isSupported(const FiniteElementSpaceBase& fes);
+
+      /**
+       * @param[in] fes H1 space of the trial and test functions
+       * @param[in] mass Coefficient @f$ \alpha @f$
+       * @param[in] diffusion Coefficient @f$ \beta @f$
+       * @param[in] order Order of the quadrature rule. By default it is
+       * exact for the mass form on affine elements.
+       */
+      MatrixFreeOperator(
+          const FiniteElementSpaceBase& fes, Scalar mass, Scalar diffusion,
+          const std::optional<size_t>& order = {});
+
+      void Mult(const mfem::Vector& x, mfem::Vector& y) const override;
+
+      void MultTranspose(const mfem::Vector& x, mfem::Vector& y) const override
+      {
+        Mult(x, y);
+      }
+
+    private:
+      using Shape = std::array<size_t, 3>;
+
+      /**
+       * Applies the matrix @f$ a @f$ along the given axis of the tensor
+       * @f$ x @f$ of the given shape, whose extent along the axis is the
+       * number of columns of @f$ a @f$. On return the shape is updated.
+       */
+      static void contract(
+          const Math::Matrix& a, const Scalar* x, Shape& shape, size_t axis, Scalar* y);
+
+      /**
+       * Applies the matrix @f$ a_k @f$ along the axis @f$ k @f$ of the
+       * tensor @f$ x @f$, for each @f$ k < d @f$.
+       */
+      void tensorProduct(
+          const std::array<const Math::Matrix*, 3>& a, const Math::Vector& x, Math::Vector& y) const;
+
+      std::vector<mfem::IntegrationPoint> setupTensor(const mfem::FiniteElement& fe, size_t order);
+
+      std::vector<mfem::IntegrationPoint> setupGeneric(const mfem::FiniteElement& fe, size_t order);
+
+      void applyTensor(const Math::Vector& x, Math::Vector& y, size_t element) const;
+
+      void applyGeneric(const Math::Vector& x, Math::Vector& y, size_t element) const;
+
+      size_t m_dimension;
+      size_t m_vdim;
+      size_t m_elements;
+      size_t m_dofs;
+      size_t m_points;
+
+      Scalar m_mass;
+      Scalar m_diffusion;
+
+      /// Element vector DOFs, m_vdim * m_dofs entries per element.
+      std::vector<int> m_vdofs;
+
+      /// @f$ \alpha w |J| @f$ at each quadrature point, one column per element.
+      Math::Matrix m_massFactors;
+
+      /// @f$ \beta w |J| J^{-1} J^{-T} @f$ at each quadrature point, one column per element.
+      Math::Matrix m_diffusionFactors;
+
+      bool m_tensor;
+
+      /// Native index of each element DOF in lexicographic order.
+      std::vector<int> m_lexicographic;
+
+      /// One dimensional basis and derivative tables, and their transposes.
+      Math::Matrix m_basis1D, m_gradient1D, m_basis1DT, m_gradient1DT;
+
+      /// Basis and gradient tables at the quadrature points of the element.
+      Math::Matrix m_basis, m_gradient;
+  };
+}
+
+namespace Rodin::Variational::Assembly
+{
+  /**
+   * @brief Matrix-free assembly of bilinear forms.
+   *
+   * Integrators which describe a mass or diffusion form with constant
+   * coefficients over the whole domain are combined into an
+   * Internal::MatrixFreeOperator per quadrature order, which never forms
+   * the global matrix. The
+   * remaining integrators are assembled by the Native policy into a sparse
+   * matrix which is added to the operator.
+   */
+  template <>
+  class MatrixFree<BilinearFormBase<mfem::Operator>>
+    : public AssemblyBase<BilinearFormBase<mfem::Operator>>
+  {
+    public:
+      using Parent = AssemblyBase<BilinearFormBase<mfem::Operator>>;
+      using OperatorType = mfem::Operator;
+
+      MatrixFree() = default;
+
+      MatrixFree(const MatrixFree& other)
+        : Parent(other)
+      {}
+
+      MatrixFree(MatrixFree&& other)
+        : Parent(std::move(other))
+      {}
+
+      std::unique_ptr<OperatorType> execute(const Input& input) const override;
+
+      MatrixFree* copy() const noexcept override
+      {
+        return new MatrixFree(*this);
+      }
+  };
+}
+
+#endif
@@ -10,118 +10,96 @@
 
 #include "Native.h"
 
-namespace Rodin::Variational::Assembly
+namespace Rodin::Variational::Internal
 {
-  mfem::SparseMatrix
-  Native<BilinearFormBase<mfem::SparseMatrix>>
-  ::execute(const Input& input) const
+  size_t getDimension(const Geometry::MeshBase& mesh, Integrator::Region region)
   {
-    OperatorType res(input.testFES.getSize(), input.trialFES.getSize());
-    res = 0.0;
-
-    FormLanguage::List<BilinearFormIntegratorBase> domainBFIs;
-    FormLanguage::List<BilinearFormIntegratorBase> facesBFIs;
-    FormLanguage::List<BilinearFormIntegratorBase> boundaryBFIs;
-    FormLanguage::List<BilinearFormIntegratorBase> interfaceBFIs;
+    return region == Integrator::Region::Domain ? mesh.getDimension() : mesh.getDimension() - 1;
+  }
 
-    for (const auto& bfi : input.bfis)
+  Geometry::IndexList getIndices(const Geometry::MeshBase& mesh, Integrator::Region region)
+  {
+    switch (region)
     {
-      switch (bfi.getRegion())
-      {
-        case Integrator::Region::Domain:
-        {
-          domainBFIs.add(bfi);
-          break;
-        }
-        case Integrator::Region::Faces:
-        {
-          facesBFIs.add(bfi);
-          break;
-        }
-        case Integrator::Region::Boundary:
-        {
-          boundaryBFIs.add(bfi);
-          break;
-        }
-        case Integrator::Region::Interface:
-        {
-          interfaceBFIs.add(bfi);
-          break;
-        }
-      }
+      case Integrator::Region::Domain:
+      case Integrator::Region::Faces:
+        return nullptr;
+      case Integrator::Region::Boundary:
+        return mesh.getBoundaryIndices();
+      case Integrator::Region::Interface:
+        return mesh.getInterfaceIndices();
     }
+    assert(false);
+    return nullptr;
+  }
 
-    if (domainBFIs.size() > 0)
+  Geometry::IndexList getIndices(
+      const Geometry::MeshBase& mesh, Integrator::Region region, Geometry::Attribute attr)
+  {
+    switch (region)
     {
-      for (auto it = input.mesh.getElement(); !it.end(); ++it)
-      {
-        const auto& element = *it;
-        const Geometry::Attribute attr = element.getAttribute();
-        for (const auto& bfi : domainBFIs)
-        {
-          if (bfi.getAttributes().size() == 0 || bfi.getAttributes().count(attr))
-          {
-            Math::Matrix mat = bfi.getMatrix(element);
-            mfem::DenseMatrix mfem;
-            mfem.UseExternalData(mat.data(), mat.rows(), mat.cols());
-            res.AddSubMatrix(
-                input.testFES.getDOFs(element), input.trialFES.getDOFs(element), mfem);
-          }
-        }
-      }
+      case Integrator::Region::Domain:
+      case Integrator::Region::Faces:
+        return mesh.getIndices(getDimension(mesh, region), attr);
+      case Integrator::Region::Boundary:
+        return mesh.getBoundaryIndices(attr);
+      case Integrator::Region::Interface:
+        return mesh.getInterfaceIndices(attr);
     }
+    assert(false);
+    return nullptr;
+  }
 
-    if (facesBFIs.size() > 0 || boundaryBFIs.size() > 0 || interfaceBFIs.size() > 0)
-    {
-      for (auto it = input.mesh.getFace(); !it.end(); ++it)
-      {
-        const auto& face = *it;
-        const Geometry::Attribute attr = face.getAttribute();
-        for (const auto& bfi : facesBFIs)
-        {
-          if (bfi.getAttributes().size() == 0 || bfi.getAttributes().count(attr))
-          {
-            Math::Matrix mat = bfi.getMatrix(face);
-            mfem::DenseMatrix mfem;
-            mfem.UseExternalData(mat.data(), mat.rows(), mat.cols());
-            res.AddSubMatrix(
-                input.testFES.getDOFs(face), input.trialFES.getDOFs(face), mfem);
-          }
-        }
+  Geometry::SimplexIterator getSimplices(
+      const Geometry::MeshBase& mesh, Integrator::Region region)
+  {
+    const size_t d = getDimension(mesh, region);
+    if (Geometry::IndexList indices = getIndices(mesh, region))
+      return Geometry::SimplexIterator(d, mesh, Geometry::RangeIndexGenerator(std::move(indices)));
+    else
+      return Geometry::SimplexIterator(
+          d, mesh, Geometry::BoundedIndexGenerator(0, mesh.getCount(d)));
+  }
 
-        if (face.isBoundary())
-        {
-          for (const auto& bfi : boundaryBFIs)
-          {
-            const Geometry::Attribute attr = input.mesh.getFaceAttribute(it->getIndex());
-            if (bfi.getAttributes().size() == 0 || bfi.getAttributes().count(attr))
-            {
-              Math::Matrix mat = bfi.getMatrix(face);
-              mfem::DenseMatrix mfem;
-              mfem.UseExternalData(mat.data(), mat.rows(), mat.cols());
-              res.AddSubMatrix(
-                  input.testFES.getDOFs(face), input.trialFES.getDOFs(face), mfem);
-            }
-          }
-        }
+  Geometry::SimplexIterator getSimplices(
+      const Geometry::MeshBase& mesh, Integrator::Region region, Geometry::Attribute attr)
+  {
+    return Geometry::SimplexIterator(
+        getDimension(mesh, region), mesh,
+        Geometry::RangeIndexGenerator(getIndices(mesh, region, attr)));
+  }
+}
 
-        if (face.isInterface())
-        {
-          for (const auto& bfi : interfaceBFIs)
-          {
-            const Geometry::Attribute attr = input.mesh.getFaceAttribute(it->getIndex());
-            if (bfi.getAttributes().size() == 0 || bfi.getAttributes().count(attr))
-            {
-              Math::Matrix mat = bfi.getMatrix(face);
-              mfem::DenseMatrix mfem;
-              mfem.UseExternalData(mat.data(), mat.rows(), mat.cols());
-              res.AddSubMatrix(
-                  input.testFES.getDOFs(face), input.trialFES.getDOFs(face), mfem);
-            }
-          }
-        }
-      }
-    }
+namespace Rodin::Variational::Assembly
+{
+  mfem::SparseMatrix
+  Native<BilinearFormBase<mfem::SparseMatrix>>
+  ::execute(const Input& input) const
+  {
+    OperatorType res(input.testFES.getSize(), input.trialFES.getSize());
+    res = 0.0;
+    Internal::traverse(input.mesh, input.bfis,
+        [&](const BilinearFormIntegratorBase& bfi, const Geometry::Simplex& simplex)
+        {
+          Math::Matrix mat = bfi.getMatrix(simplex);
+          mfem::DenseMatrix mfem;
+          mfem.UseExternalData(mat.data(), mat.rows(), mat.cols());
+          res.AddSubMatrix(
+              input.testFES.getDOFs(simplex), input.trialFES.getDOFs(simplex), mfem);
+        });
+    return res;
+  }
+
+  std::unique_ptr<mfem::Operator>
+  Native<BilinearFormBase<mfem::Operator>>
+  ::execute(const Input& input) const
+  {
+    mfem::SparseMatrix mat =
+      Native<BilinearFormBase<mfem::SparseMatrix>>().execute(
+          { input.mesh, input.trialFES, input.testFES, input.bfis });
+    std::unique_ptr<mfem::SparseMatrix> res(new mfem::SparseMatrix);
+    res->Swap(mat);
+    res->Finalize();
     return res;
   }
 
@@ -131,107 +109,14 @@ namespace Rodin::Variational::Assembly
   {
     VectorType res(input.fes.getSize());
     res = 0.0;
-
-    FormLanguage::List<LinearFormIntegratorBase> domainLFIs;
-    FormLanguage::List<LinearFormIntegratorBase> facesLFIs;
-    FormLanguage::List<LinearFormIntegratorBase> boundaryLFIs;
-    FormLanguage::List<LinearFormIntegratorBase> interfaceLFIs;
-
-    for (const auto& lfi : input.lfis)
-    {
-      switch (lfi.getRegion())
-      {
-        case Integrator::Region::Domain:
-        {
-          domainLFIs.add(lfi);
-          break;
-        }
-        case Integrator::Region::Faces:
-        {
-          facesLFIs.add(lfi);
-          break;
-        }
-        case Integrator::Region::Boundary:
-        {
-          boundaryLFIs.add(lfi);
-          break;
-        }
-        case Integrator::Region::Interface:
-        {
-          interfaceLFIs.add(lfi);
-          break;
-        }
-      }
-    }
-
-    if (domainLFIs.size() > 0)
-    {
-      for (auto it = input.mesh.getElement(); !it.end(); ++it)
-      {
-        const auto& element = *it;
-        const Geometry::Attribute attr = element.getAttribute();
-        for (const auto& lfi : domainLFIs)
-        {
-          if (lfi.getAttributes().size() == 0 || lfi.getAttributes().count(attr))
-          {
-            Math::Vector vec = lfi.getVector(element);
-            mfem::Vector mvec;
-            mvec.SetDataAndSize(vec.data(), vec.size());
-            res.AddElementVector(input.fes.getDOFs(element), mvec);
-          }
-        }
-      }
-    }
-
-    if (facesLFIs.size() > 0 || boundaryLFIs.size() > 0 || interfaceLFIs.size() > 0)
-    {
-      for (auto it = input.mesh.getFace(); !it.end(); ++it)
-      {
-        const auto& face = *it;
-        const Geometry::Attribute attr = face.getAttribute();
-        for (const auto& lfi : facesLFIs)
-        {
-          if (lfi.getAttributes().size() == 0 || lfi.getAttributes().count(attr))
-          {
-            Math::Vector vec = lfi.getVector(face);
-            mfem::Vector mvec;
-            mvec.SetDataAndSize(vec.data(), vec.size());
-            res.AddElementVector(input.fes.getDOFs(face), mvec);
-          }
-        }
-
-        if (face.isBoundary())
-        {
-          for (const auto& lfi : boundaryLFIs)
-          {
-            if (lfi.getAttributes().size() == 0 || lfi.getAttributes().count(attr))
-            {
-              Math::Vector vec = lfi.getVector(face);
-              mfem::Vector mvec;
-              mvec.SetDataAndSize(vec.data(), vec.size());
-              res.AddElementVector(input.fes.getDOFs(face), mvec);
-            }
-          }
-        }
-
-        if (face.isInterface())
-        {
-          for (const auto& lfi : interfaceLFIs)
-          {
-            const Geometry::Attribute attr = input.mesh.getFaceAttribute(it->getIndex());
-            if (lfi.getAttributes().size() == 0 || lfi.getAttributes().count(attr))
-            {
-              Math::Vector vec = lfi.getVector(face);
-              mfem::Vector mvec;
-              mvec.SetDataAndSize(vec.data(), vec.size());
-              res.AddElementVector(input.fes.getDOFs(face), mvec);
-            }
-          }
-        }
-      }
-    }
+    Internal::traverse(input.mesh, input.lfis,
+        [&](const LinearFormIntegratorBase& lfi, const Geometry::Simplex& simplex)
+        {
+          Math::Vector vec = lfi.getVector(simplex);
+          mfem::Vector mvec;
+          mvec.SetDataAndSize(vec.data(), vec.size());
+          res.AddElementVector(input.fes.getDOFs(simplex), mvec);
+        });
     return res;
   }
 }
-
-
@@ -9,11 +9,100 @@
 
 #include <variant>
 #include <ostream>
+#include <vector>
 
 #include <mfem.hpp>
 
 #include "AssemblyBase.h"
 
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Gets the dimension of the simplices of the region.
+   */
+  size_t getDimension(const Geometry::MeshBase& mesh, Integrator::Region region);
+
+  /**
+   * @internal
+   * @brief Gets the indices of the simplices of the region.
+   * @returns Null if the region is made of all the simplices of its
+   * dimension.
+   */
+  Geometry::IndexList getIndices(const Geometry::MeshBase& mesh, Integrator::Region region);
+
+  /**
+   * @internal
+   * @brief Gets the indices of the simplices of the region with the given
+   * attribute.
+   */
+  Geometry::IndexList getIndices(
+      const Geometry::MeshBase& mesh, Integrator::Region region, Geometry::Attribute attr);
+
+  /**
+   * @internal
+   * @brief Iterates over all the simplices of the region.
+   */
+  Geometry::SimplexIterator getSimplices(
+      const Geometry::MeshBase& mesh, Integrator::Region region);
+
+  /**
+   * @internal
+   * @brief Iterates over the simplices of the region with the given
+   * attribute.
+   */
+  Geometry::SimplexIterator getSimplices(
+      const Geometry::MeshBase& mesh, Integrator::Region region, Geometry::Attribute attr);
+
+  /**
+   * @internal
+   * @brief Calls the assembly function for each integrator and each
+   * simplex of its region.
+   *
+   * The integrators which are not restricted to some attributes are
+   * assembled in a single traversal of the region, while the restricted
+   * ones only visit the simplices of their attributes.
+   */
+  template <class IntegratorBase, class Function>
+  void traverse(
+      const Geometry::MeshBase& mesh, const FormLanguage::List<IntegratorBase>& integrators,
+      Function&& assemble)
+  {
+    for (const auto region : {
+        Integrator::Region::Domain, Integrator::Region::Faces,
+        Integrator::Region::Boundary, Integrator::Region::Interface })
+    {
+      std::vector<const IntegratorBase*> unrestricted;
+      for (const auto& integrator : integrators)
+      {
+        if (integrator.getRegion() != region)
+          continue;
+        if (integrator.getAttributes().size() == 0)
+        {
+          unrestricted.push_back(&integrator);
+        }
+        else
+        {
+          for (const Geometry::Attribute attr : integrator.getAttributes())
+          {
+            for (auto it = getSimplices(mesh, region, attr); !it.end(); ++it)
+              assemble(integrator, *it);
+          }
+        }
+      }
+
+      if (unrestricted.size() > 0)
+      {
+        for (auto it = getSimplices(mesh, region); !it.end(); ++it)
+        {
+          for (const auto* integrator : unrestricted)
+            assemble(*integrator, *it);
+        }
+      }
+    }
+  }
+}
+
 namespace Rodin::Variational::Assembly
 {
   template <>
@@ -42,6 +131,36 @@ namespace Rodin::Variational::Assembly
       }
   };
 
+  /**
+   * @brief Assembles the bilinear form into a sparse matrix, which is then
+   * exposed through its action.
+   */
+  template <>
+  class Native<BilinearFormBase<mfem::Operator>>
+    : public AssemblyBase<BilinearFormBase<mfem::Operator>>
+  {
+    public:
+      using Parent = AssemblyBase<BilinearFormBase<mfem::Operator>>;
+      using OperatorType = mfem::Operator;
+
+      Native() = default;
+
+      Native(const Native& other)
+        : Parent(other)
+      {}
+
+      Native(Native&& other)
+        : Parent(std::move(other))
+      {}
+
+      std::unique_ptr<OperatorType> execute(const Input& input) const override;
+
+      Native* copy() const noexcept override
+      {
+        return new Native(*this);
+      }
+  };
+
   template <>
   class Native<LinearFormBase<mfem::Vector>>
     : public AssemblyBase<LinearFormBase<mfem::Vector>>
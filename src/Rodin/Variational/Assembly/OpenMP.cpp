@@ -1,73 +1,151 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "Rodin/Configure.h"
+
 #ifdef RODIN_USE_OPENMP
 
 #include <omp.h>
 
 #include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/LinearFormIntegrator.h"
 #include "Rodin/Variational/BilinearFormIntegrator.h"
 
 #include "OpenMP.h"
 
 namespace Rodin::Variational::Assembly
 {
+  namespace
+  {
+    struct ElementMatrix
+    {
+      const mfem::Array<int>& rows;
+      const mfem::Array<int>& columns;
+      Math::Matrix matrix;
+    };
+
+    struct ElementVector
+    {
+      const mfem::Array<int>& dofs;
+      Math::Vector vector;
+    };
+  }
+
   mfem::SparseMatrix
   OpenMP<BilinearFormBase<mfem::SparseMatrix>>
   ::execute(const Input& input) const
   {
-    OperatorType result(input.testFES.getSize(), input.trialFES.getSize());
-    result = 0.0;
+    OperatorType res(input.testFES.getSize(), input.trialFES.getSize());
+    res = 0.0;
+    Internal::traverse(input.mesh, input.bfis, m_blockSize,
+        [&](const BilinearFormIntegratorBase& bfi, const Geometry::Simplex& simplex)
+        {
+          return ElementMatrix{
+            input.testFES.getDOFs(simplex),
+            input.trialFES.getDOFs(simplex),
+            bfi.getMatrix(simplex) };
+        },
+        [&](const BilinearFormIntegratorBase&, ElementMatrix&& element)
+        {
+          mfem::DenseMatrix mfem;
+          mfem.UseExternalData(
+              element.matrix.data(), element.matrix.rows(), element.matrix.cols());
+          res.AddSubMatrix(element.rows, element.columns, mfem);
+        });
+    return res;
+  }
 
-    for (const auto& bfi : input.bfis)
-    {
-      switch (bfi.getRegion())
+  mfem::Vector
+  OpenMP<LinearFormBase<mfem::Vector>>
+  ::execute(const Input& input) const
+  {
+    VectorType res(input.fes.getSize());
+    res = 0.0;
+
+    // Each thread adds the entries of the element vectors which lie in its
+    // own range of DOFs, in the order of the serial traversal. The entries
+    // are first sorted by range, each thread sorting those of a chunk of
+    // the element vectors, so that each thread then only visits its own.
+    std::vector<ElementVector> block;
+    std::vector<size_t> offsets;
+    std::vector<std::pair<size_t, int>> entries;
+    const auto flush =
+      [&]()
       {
-        case Geometry::Region::Domain:
-        {
-          std::vector<OperatorType> local;
+        const size_t size = res.Size();
+        const size_t n = block.size();
 #pragma omp parallel
-          {
-            const int id = omp_get_thread_num();
-#pragma omp master
+        {
+          const size_t count = omp_get_num_threads();
+          const size_t thread = omp_get_thread_num();
+          const size_t first = (n * thread) / count;
+          const size_t last = (n * (thread + 1)) / count;
+          const auto owner =
+            [&](int dof)
             {
-              const int nt = omp_get_num_threads();
-              local.reserve(nt);
-              for (int i = 0; i < nt; i++)
-                local.emplace_back(input.testFES.getSize(), input.trialFES.getSize());
-            }
+              const size_t j = dof >= 0 ? dof : -1 - dof;
+              return (j * count) / size;
+            };
+
+          // Entries owned by thread t from the chunk of thread c go to the
+          // bucket t * count + c
+#pragma omp single
+          offsets.assign(count * count + 1, 0);
+          for (size_t e = first; e < last; e++)
+          {
+            const auto& dofs = block[e].dofs;
+            for (int i = 0; i < dofs.Size(); i++)
+              offsets[owner(dofs[i]) * count + thread + 1]++;
+          }
 #pragma omp barrier
-#pragma omp for
-            for (int i = 0; i < input.mesh.count<Geometry::Element>(); i++)
-            {
-              const auto& element = input.mesh.get<Geometry::Element>(i);
-              if (bfi.getAttributes().size() == 0
-                  || bfi.getAttributes().count(element.getAttribute()))
-              {
-                local[id].AddSubMatrix(
-                    input.testFES.getDOFs(element),
-                    input.trialFES.getDOFs(element),
-                    bfi.getElementMatrix(element));
-              }
-            }
-#pragma omp critical
-            {
-              result += local[id];
-            }
+#pragma omp single
+          {
+            for (size_t b = 0; b < count * count; b++)
+              offsets[b + 1] += offsets[b];
+            entries.resize(offsets.back());
+          }
+
+          std::vector<size_t> position(count);
+          for (size_t t = 0; t < count; t++)
+            position[t] = offsets[t * count + thread];
+          for (size_t e = first; e < last; e++)
+          {
+            const auto& dofs = block[e].dofs;
+            for (int i = 0; i < dofs.Size(); i++)
+              entries[position[owner(dofs[i])]++] = { e, i };
+          }
+#pragma omp barrier
+
+          for (size_t k = offsets[thread * count]; k < offsets[(thread + 1) * count]; k++)
+          {
+            const auto& [e, i] = entries[k];
+            const auto& element = block[e];
+            const int dof = element.dofs[i];
+            if (dof >= 0)
+              res[dof] += element.vector.coeff(i);
+            else
+              res[-1 - dof] -= element.vector.coeff(i);
           }
-          break;
         }
-        case Geometry::Region::Boundary:
+        block.clear();
+      };
+
+    Internal::traverse(input.mesh, input.lfis, m_blockSize,
+        [&](const LinearFormIntegratorBase& lfi, const Geometry::Simplex& simplex)
         {
-          assert(false);
-          break;
-        }
-        case Geometry::Region::Interface:
+          return ElementVector{ input.fes.getDOFs(simplex), lfi.getVector(simplex) };
+        },
+        [&](const LinearFormIntegratorBase&, ElementVector&& element)
         {
-          assert(false);
-          break;
-        }
-      }
-    }
-
-    return result;
+          block.push_back(std::move(element));
+          if (block.size() >= m_blockSize)
+            flush();
+        });
+    flush();
+    return res;
   }
 }
 
@@ -4,20 +4,139 @@
  *       (See accompanying file LICENSE or copy at
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
-#ifdef RODIN_USE_OPENMP
-
 #ifndef RODIN_ASSEMBLY_OPENMP_H
 #define RODIN_ASSEMBLY_OPENMP_H
 
-#include <variant>
-#include <ostream>
+#include "Rodin/Configure.h"
+
+#ifdef RODIN_USE_OPENMP
+
+#include <set>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
 
 #include <mfem.hpp>
 
+#include "Rodin/Geometry/SimplexIterator.h"
+
 #include "AssemblyBase.h"
+#include "Native.h"
+
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Parallel counterpart of traverse() whose result does not depend
+   * on the number of threads.
+   *
+   * The pairs of integrator and simplex are visited in the same order as
+   * in traverse(). This order is read from the index lists of the mesh,
+   * as runs of simplices which are visited by the same integrators, so
+   * that no serial traversal precedes the parallel one. Each run is
+   * processed by consecutive blocks of at most @p blockSize simplices. The
+   * local contributions of a block are computed in parallel by @p compute,
+   * and then handed to @p scatter one at a time, in the order of the serial
+   * traversal. Since neither the blocks nor the order of the reduction
+   * depend on the number of threads, the assembled operator is the same,
+   * bit for bit, as the one of the serial traversal.
+   *
+   * The transformations of the visited dimensions are built beforehand
+   * with Geometry::MeshBase::precomputeTransformations(), so that the
+   * parallel region only reads them.
+   */
+  template <class IntegratorBase, class Compute, class Scatter>
+  void traverse(
+      const Geometry::MeshBase& mesh, const FormLanguage::List<IntegratorBase>& integrators,
+      size_t blockSize, Compute&& compute, Scatter&& scatter)
+  {
+    using Result =
+      std::invoke_result_t<Compute, const IntegratorBase&, const Geometry::Simplex&>;
+
+    // Simplices which are visited by the same integrators. They are all
+    // the simplices of the dimension if there is no index list.
+    struct Run
+    {
+      size_t dimension;
+      Geometry::IndexList indices;
+      std::vector<const IntegratorBase*> integrators;
+    };
+
+    std::vector<Run> runs;
+    std::set<size_t> dimensions;
+    for (const auto region : {
+        Integrator::Region::Domain, Integrator::Region::Faces,
+        Integrator::Region::Boundary, Integrator::Region::Interface })
+    {
+      const size_t d = getDimension(mesh, region);
+      std::vector<const IntegratorBase*> unrestricted;
+      for (const auto& integrator : integrators)
+      {
+        if (integrator.getRegion() != region)
+          continue;
+        if (integrator.getAttributes().size() == 0)
+        {
+          unrestricted.push_back(&integrator);
+        }
+        else
+        {
+          for (const Geometry::Attribute attr : integrator.getAttributes())
+            runs.push_back({ d, getIndices(mesh, region, attr), { &integrator } });
+        }
+      }
+
+      if (unrestricted.size() > 0)
+        runs.push_back({ d, getIndices(mesh, region), std::move(unrestricted) });
+    }
+    for (const auto& run : runs)
+      dimensions.insert(run.dimension);
+    for (const size_t d : dimensions)
+      mesh.precomputeTransformations(d);
+
+    assert(blockSize > 0);
+    std::vector<std::optional<Result>> results;
+    for (const auto& run : runs)
+    {
+      const size_t size = run.indices ? run.indices->size() : mesh.getCount(run.dimension);
+      const size_t n = run.integrators.size();
+      for (size_t first = 0; first < size; first += blockSize)
+      {
+        const size_t last = std::min(first + blockSize, size);
+        results.clear();
+        results.resize((last - first) * n);
+
+#pragma omp parallel for schedule(static)
+        for (size_t i = first; i < last; i++)
+        {
+          const Index index = run.indices ? (*run.indices)[i] : i;
+          Geometry::SimplexIterator it(
+              run.dimension, mesh, Geometry::BoundedIndexGenerator(index, index + 1));
+          for (size_t k = 0; k < n; k++)
+            results[(i - first) * n + k].emplace(compute(*run.integrators[k], *it));
+        }
+
+        for (size_t k = 0; k < results.size(); k++)
+          scatter(*run.integrators[k % n], std::move(*results[k]));
+      }
+    }
+  }
+}
 
 namespace Rodin::Variational::Assembly
 {
+  /**
+   * @brief Multithreaded assembly of bilinear forms with OpenMP.
+   *
+   * The element matrices are computed in parallel while they are added to
+   * the global matrix in the same order as in the Native policy, so that
+   * the result is identical to the Native one for any number of threads.
+   *
+   * The finite element collections are evaluated concurrently, which
+   * requires MFEM to be configured with @p MFEM_THREAD_SAFE.
+   *
+   * @see Internal::traverse(const Geometry::MeshBase&, const FormLanguage::List<IntegratorBase>&, size_t, Compute&&, Scatter&&)
+   */
   template <>
   class OpenMP<BilinearFormBase<mfem::SparseMatrix>>
     : public AssemblyBase<BilinearFormBase<mfem::SparseMatrix>>
@@ -26,22 +145,98 @@ namespace Rodin::Variational::Assembly
       using Parent = AssemblyBase<BilinearFormBase<mfem::SparseMatrix>>;
       using OperatorType = mfem::SparseMatrix;
 
-      OpenMP() = default;
+      static constexpr const size_t DefaultBlockSize = 4096;
+
+      /**
+       * @param[in] blockSize Number of simplices whose element matrices are
+       * computed before being added to the global matrix.
+       */
+      OpenMP(size_t blockSize = DefaultBlockSize)
+        : m_blockSize(blockSize)
+      {}
 
       OpenMP(const OpenMP& other)
-        : Parent(other)
+        : Parent(other),
+          m_blockSize(other.m_blockSize)
       {}
 
       OpenMP(OpenMP&& other)
-        : Parent(std::move(other))
+        : Parent(std::move(other)),
+          m_blockSize(other.m_blockSize)
       {}
 
+      size_t getBlockSize() const
+      {
+        return m_blockSize;
+      }
+
       OperatorType execute(const Input& input) const override;
 
       OpenMP* copy() const noexcept override
       {
         return new OpenMP(*this);
       }
+
+    private:
+      size_t m_blockSize;
+  };
+
+  /**
+   * @brief Multithreaded assembly of linear forms with OpenMP.
+   *
+   * The element vectors of the integrators of all the regions are computed
+   * in parallel. They are then added to the global vector by all the
+   * threads at once, each thread owning a range of the degrees of freedom.
+   * The entries of each block are sorted by owner beforehand, so each
+   * thread only visits its own entries and adds them in the same order as
+   * the Native policy. Hence no synchronization is required and the result
+   * is identical to the Native one for any number of threads.
+   *
+   * @see OpenMP<BilinearFormBase<mfem::SparseMatrix>>
+   */
+  template <>
+  class OpenMP<LinearFormBase<mfem::Vector>>
+    : public AssemblyBase<LinearFormBase<mfem::Vector>>
+  {
+    public:
+      using Parent = AssemblyBase<LinearFormBase<mfem::Vector>>;
+      using VectorType = mfem::Vector;
+
+      static constexpr const size_t DefaultBlockSize = 4096;
+
+      /**
+       * @param[in] blockSize Number of simplices, respectively of element
+       * vectors, which are computed, respectively added to the global
+       * vector, at once.
+       */
+      OpenMP(size_t blockSize = DefaultBlockSize)
+        : m_blockSize(blockSize)
+      {}
+
+      OpenMP(const OpenMP& other)
+        : Parent(other),
+          m_blockSize(other.m_blockSize)
+      {}
+
+      OpenMP(OpenMP&& other)
+        : Parent(std::move(other)),
+          m_blockSize(other.m_blockSize)
+      {}
+
+      size_t getBlockSize() const
+      {
+        return m_blockSize;
+      }
+
+      VectorType execute(const Input& input) const override;
+
+      OpenMP* copy() const noexcept override
+      {
+        return new OpenMP(*this);
+      }
+
+    private:
+      size_t m_blockSize;
   };
 }
 
@@ -0,0 +1,100 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "Split.h"
+#include "Partial.h"
+
+namespace Rodin::Variational::Internal
+{
+  bool PartialAssemblyOperator::isSupported(
+      const FiniteElementSpaceBase& fes, mfem::AssemblyLevel level)
+  {
+    if (level == mfem::AssemblyLevel::LEGACY)
+      return true;
+    // The mfem mass and diffusion kernels of the other levels only handle
+    // H1 spaces on tensor product elements, of a mesh with a single
+    // geometry and of the same dimension as the space
+    const auto& handle = fes.getHandle();
+    if (!dynamic_cast<const mfem::H1_FECollection*>(handle.FEColl()))
+      return false;
+    const auto& mesh = fes.getMesh();
+    if (mesh.getDimension() != mesh.getSpaceDimension())
+      return false;
+    if (handle.GetNE() == 0 || mesh.getHandle().GetNumGeometries(mesh.getDimension()) != 1)
+      return false;
+    return mfem::UsesTensorBasis(handle);
+  }
+
+  PartialAssemblyOperator::PartialAssemblyOperator(
+      const FiniteElementSpaceBase& fes, mfem::AssemblyLevel level,
+      const FormLanguage::List<BilinearFormIntegratorBase>& bfis)
+    : mfem::Operator(fes.getSize()),
+      m_form(new mfem::BilinearForm(&fes.getHandle()))
+  {
+    using Type = BilinearFormIntegratorBase::StandardForm::Type;
+    const bool vector = fes.getVectorDimension() > 1;
+    const auto& mesh = fes.getMesh().getHandle();
+    m_form->SetAssemblyLevel(level);
+    for (const auto& bfi : bfis)
+    {
+      const auto form = bfi.getStandardForm();
+      assert(form);
+      assert(form->type == Type::Mass || form->type == Type::Diffusion);
+      auto& coefficient = m_coefficients.emplace_back(form->coefficient);
+      mfem::BilinearFormIntegrator* integrator;
+      if (form->type == Type::Mass)
+      {
+        if (vector)
+          integrator = new mfem::VectorMassIntegrator(coefficient);
+        else
+          integrator = new mfem::MassIntegrator(coefficient);
+      }
+      else
+      {
+        if (vector)
+          integrator = new mfem::VectorDiffusionIntegrator(coefficient);
+        else
+          integrator = new mfem::DiffusionIntegrator(coefficient);
+      }
+      if (const auto& order = bfi.getQuadratureOrder())
+      {
+        assert(mesh.GetNumGeometries(mesh.Dimension()) == 1);
+        integrator->SetIntRule(&mfem::IntRules.Get(mesh.GetElementBaseGeometry(0), *order));
+      }
+      m_form->AddDomainIntegrator(integrator);
+    }
+    m_form->Assemble();
+  }
+}
+
+namespace Rodin::Variational::Assembly
+{
+  std::unique_ptr<mfem::Operator>
+  Partial<BilinearFormBase<mfem::Operator>>
+  ::execute(const Input& input) const
+  {
+    const bool supported =
+      input.trialFES == input.testFES
+      && Internal::PartialAssemblyOperator::isSupported(input.trialFES, m_level);
+    const auto& mesh = input.trialFES.getMesh().getHandle();
+    const bool singleGeometry = mesh.GetNumGeometries(mesh.Dimension()) == 1;
+    return Internal::split(input,
+        [&](const BilinearFormIntegratorBase& bfi)
+        {
+          // A quadrature order is only honoured through a single rule
+          return supported && Internal::isMassOrDiffusion(bfi)
+            && (!bfi.getQuadratureOrder() || singleGeometry);
+        },
+        [&](const FormLanguage::List<BilinearFormIntegratorBase>& bfis)
+        {
+          return std::unique_ptr<mfem::Operator>(
+              new Internal::PartialAssemblyOperator(input.trialFES, m_level, bfis));
+        });
+  }
+}
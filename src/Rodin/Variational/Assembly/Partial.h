@@ -0,0 +1,119 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_PARTIAL_H
+#define RODIN_ASSEMBLY_PARTIAL_H
+
+#include <deque>
+#include <memory>
+
+#include <mfem.hpp>
+
+#include "AssemblyBase.h"
+
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Operator of a sum of mass and diffusion forms with constant
+   * coefficients, assembled by mfem at the given assembly level.
+   *
+   * Each form is assembled by its own mfem integrator, with the quadrature
+   * rule of the order set on the form, if any.
+   */
+  class PartialAssemblyOperator : public mfem::Operator
+  {
+    public:
+      /**
+       * @brief Determines if mfem provides the mass and diffusion kernels of
+       * the given assembly level on the given space.
+       */
+      static bool isSupported(const FiniteElementSpaceBase& fes, mfem::AssemblyLevel level);
+
+      /**
+       * @param[in] fes Finite element space of the trial and test functions
+       * @param[in] level Assembly level
+       * @param[in] bfis Mass and diffusion integrators over the whole domain
+       * @see isMassOrDiffusion(const BilinearFormIntegratorBase&)
+       */
+      PartialAssemblyOperator(
+          const FiniteElementSpaceBase& fes, mfem::AssemblyLevel level,
+          const FormLanguage::List<BilinearFormIntegratorBase>& bfis);
+
+      void Mult(const mfem::Vector& x, mfem::Vector& y) const override
+      {
+        m_form->Mult(x, y);
+      }
+
+      void MultTranspose(const mfem::Vector& x, mfem::Vector& y) const override
+      {
+        m_form->MultTranspose(x, y);
+      }
+
+    private:
+      // The coefficients must outlive the form
+      std::deque<mfem::ConstantCoefficient> m_coefficients;
+      std::unique_ptr<mfem::BilinearForm> m_form;
+  };
+}
+
+namespace Rodin::Variational::Assembly
+{
+  /**
+   * @brief Assembly of bilinear forms through the mfem assembly levels.
+   *
+   * Integrators which describe a mass or diffusion form with constant
+   * coefficients over the whole domain are delegated to the corresponding
+   * mfem integrators, assembled at the given level, e.g.
+   * `mfem::AssemblyLevel::PARTIAL` which only stores the geometric factors
+   * at the quadrature points. The remaining integrators are assembled by
+   * the Native policy into a sparse matrix which is added to the operator.
+   * If mfem does not provide the kernels of the level for the space, all
+   * the integrators are assembled by the Native policy.
+   *
+   * @see Internal::PartialAssemblyOperator::isSupported()
+   */
+  template <>
+  class Partial<BilinearFormBase<mfem::Operator>>
+    : public AssemblyBase<BilinearFormBase<mfem::Operator>>
+  {
+    public:
+      using Parent = AssemblyBase<BilinearFormBase<mfem::Operator>>;
+      using OperatorType = mfem::Operator;
+
+      Partial(mfem::AssemblyLevel level = mfem::AssemblyLevel::PARTIAL)
+        : m_level(level)
+      {}
+
+      Partial(const Partial& other)
+        : Parent(other),
+          m_level(other.m_level)
+      {}
+
+      Partial(Partial&& other)
+        : Parent(std::move(other)),
+          m_level(other.m_level)
+      {}
+
+      inline
+      mfem::AssemblyLevel getLevel() const
+      {
+        return m_level;
+      }
+
+      std::unique_ptr<OperatorType> execute(const Input& input) const override;
+
+      Partial* copy() const noexcept override
+      {
+        return new Partial(*this);
+      }
+
+    private:
+      mfem::AssemblyLevel m_level;
+  };
+}
+
+#endif
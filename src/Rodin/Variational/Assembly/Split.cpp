@@ -0,0 +1,86 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "Native.h"
+#include "Split.h"
+
+namespace Rodin::Variational::Internal
+{
+  OperatorSum::OperatorSum(std::vector<std::unique_ptr<mfem::Operator>>&& operators)
+    : mfem::Operator(operators.front()->Height(), operators.front()->Width()),
+      m_operators(std::move(operators))
+  {
+    for (const auto& op : m_operators)
+    {
+      assert(op->Height() == height);
+      assert(op->Width() == width);
+    }
+  }
+
+  void OperatorSum::Mult(const mfem::Vector& x, mfem::Vector& y) const
+  {
+    m_operators.front()->Mult(x, y);
+    m_tmp.SetSize(height);
+    for (auto it = std::next(m_operators.begin()); it != m_operators.end(); ++it)
+    {
+      (*it)->Mult(x, m_tmp);
+      y += m_tmp;
+    }
+  }
+
+  void OperatorSum::MultTranspose(const mfem::Vector& x, mfem::Vector& y) const
+  {
+    m_operators.front()->MultTranspose(x, y);
+    m_tmp.SetSize(width);
+    for (auto it = std::next(m_operators.begin()); it != m_operators.end(); ++it)
+    {
+      (*it)->MultTranspose(x, m_tmp);
+      y += m_tmp;
+    }
+  }
+
+  std::unique_ptr<mfem::Operator> split(
+      const Assembly::AssemblyBase<BilinearFormBase<mfem::Operator>>::Input& input,
+      const std::function<bool(const BilinearFormIntegratorBase&)>& accept,
+      const std::function<std::unique_ptr<mfem::Operator>(
+        const FormLanguage::List<BilinearFormIntegratorBase>&)>& build)
+  {
+    FormLanguage::List<BilinearFormIntegratorBase> accepted;
+    FormLanguage::List<BilinearFormIntegratorBase> rest;
+    for (const auto& bfi : input.bfis)
+    {
+      if (accept(bfi))
+        accepted.add(bfi);
+      else
+        rest.add(bfi);
+    }
+
+    std::vector<std::unique_ptr<mfem::Operator>> operators;
+    if (accepted.size() > 0)
+      operators.push_back(build(accepted));
+    if (rest.size() > 0 || operators.empty())
+    {
+      operators.push_back(
+          Assembly::Native<BilinearFormBase<mfem::Operator>>().execute(
+            { input.mesh, input.trialFES, input.testFES, rest }));
+    }
+    if (operators.size() == 1)
+      return std::move(operators.front());
+    return std::unique_ptr<mfem::Operator>(new OperatorSum(std::move(operators)));
+  }
+
+  bool isMassOrDiffusion(const BilinearFormIntegratorBase& bfi)
+  {
+    using Type = BilinearFormIntegratorBase::StandardForm::Type;
+    if (bfi.getRegion() != Integrator::Region::Domain || bfi.getAttributes().size() > 0)
+      return false;
+    const auto form = bfi.getStandardForm();
+    return form && (form->type == Type::Mass || form->type == Type::Diffusion);
+  }
+}
@@ -0,0 +1,66 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_SPLIT_H
+#define RODIN_ASSEMBLY_SPLIT_H
+
+#include <memory>
+#include <vector>
+#include <functional>
+
+#include <mfem.hpp>
+
+#include "AssemblyBase.h"
+
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Sum of operators of the same size.
+   */
+  class OperatorSum : public mfem::Operator
+  {
+    public:
+      OperatorSum(std::vector<std::unique_ptr<mfem::Operator>>&& operators);
+
+      void Mult(const mfem::Vector& x, mfem::Vector& y) const override;
+
+      void MultTranspose(const mfem::Vector& x, mfem::Vector& y) const override;
+
+    private:
+      std::vector<std::unique_ptr<mfem::Operator>> m_operators;
+      mutable mfem::Vector m_tmp;
+  };
+
+  /**
+   * @internal
+   * @brief Assembles an operator as the sum of a specialized operator for
+   * some of the integrators and of the Native operator of the other ones.
+   * @param[in] input Input of the assembly
+   * @param[in] accept Determines if an integrator is handled by the
+   * specialized operator
+   * @param[in] build Builds the specialized operator from the accepted
+   * integrators, which are never empty
+   *
+   * The integrators which are not accepted are assembled by the Native
+   * policy into a sparse matrix. If there are no integrators at all, the
+   * Native operator is returned.
+   */
+  std::unique_ptr<mfem::Operator> split(
+      const Assembly::AssemblyBase<BilinearFormBase<mfem::Operator>>::Input& input,
+      const std::function<bool(const BilinearFormIntegratorBase&)>& accept,
+      const std::function<std::unique_ptr<mfem::Operator>(
+        const FormLanguage::List<BilinearFormIntegratorBase>&)>& build);
+
+  /**
+   * @internal
+   * @brief Determines if the integrator is a mass or a diffusion form with a
+   * constant coefficient over the whole domain.
+   */
+  bool isMassOrDiffusion(const BilinearFormIntegratorBase& bfi);
+}
+
+#endif
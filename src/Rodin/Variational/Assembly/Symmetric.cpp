@@ -0,0 +1,93 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "Native.h"
+#include "Split.h"
+#include "Symmetric.h"
+
+namespace Rodin::Variational::Internal
+{
+  SymmetricSparseMatrix::SymmetricSparseMatrix(mfem::SparseMatrix&& upper)
+    : mfem::Operator(upper.Height())
+  {
+    assert(upper.Height() == upper.Width());
+    assert(upper.Finalized());
+    m_upper.Swap(upper);
+  }
+
+  void SymmetricSparseMatrix::Mult(const mfem::Vector& x, mfem::Vector& y) const
+  {
+    assert(x.Size() == width);
+    assert(y.Size() == height);
+    const int* rows = m_upper.GetI();
+    const int* cols = m_upper.GetJ();
+    const Scalar* data = m_upper.GetData();
+    const Scalar* xd = x.GetData();
+    Scalar* yd = y.GetData();
+    y = 0.0;
+    for (int i = 0; i < height; i++)
+    {
+      const Scalar xi = xd[i];
+      Scalar yi = 0;
+      for (int k = rows[i]; k < rows[i + 1]; k++)
+      {
+        const int j = cols[k];
+        assert(j >= i);
+        yi += data[k] * xd[j];
+        if (j != i)
+          yd[j] += data[k] * xi;
+      }
+      yd[i] += yi;
+    }
+  }
+}
+
+namespace Rodin::Variational::Assembly
+{
+  std::unique_ptr<mfem::Operator>
+  Symmetric<BilinearFormBase<mfem::Operator>>
+  ::execute(const Input& input) const
+  {
+    const auto& fes = input.trialFES;
+    return Internal::split(input,
+        [&](const BilinearFormIntegratorBase& bfi)
+        {
+          return input.trialFES == input.testFES && bfi.isSymmetric();
+        },
+        [&](const FormLanguage::List<BilinearFormIntegratorBase>& bfis)
+        {
+          mfem::SparseMatrix upper(fes.getSize(), fes.getSize());
+          Internal::traverse(input.mesh, bfis,
+              [&](const BilinearFormIntegratorBase& bfi, const Geometry::Simplex& simplex)
+              {
+                const Math::Matrix mat = bfi.getMatrix(simplex);
+                const mfem::Array<int>& dofs = fes.getDOFs(simplex);
+                assert(mat.rows() == dofs.Size());
+                assert(mat.cols() == dofs.Size());
+                for (int j = 0; j < dofs.Size(); j++)
+                {
+                  const int gj = dofs[j] >= 0 ? dofs[j] : -1 - dofs[j];
+                  const Scalar sj = dofs[j] >= 0 ? 1.0 : -1.0;
+                  for (int i = 0; i < dofs.Size(); i++)
+                  {
+                    // Exactly one of (i, j) and (j, i) lies in the upper triangle
+                    const int gi = dofs[i] >= 0 ? dofs[i] : -1 - dofs[i];
+                    if (gi > gj)
+                      continue;
+                    const Scalar si = dofs[i] >= 0 ? 1.0 : -1.0;
+                    upper.Add(gi, gj, si * sj * mat(i, j));
+                  }
+                }
+              });
+          upper.Finalize();
+          return std::unique_ptr<mfem::Operator>(
+              new Internal::SymmetricSparseMatrix(std::move(upper)));
+        });
+  }
+}
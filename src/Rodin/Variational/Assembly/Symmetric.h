@@ -0,0 +1,111 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_SYMMETRIC_H
+#define RODIN_ASSEMBLY_SYMMETRIC_H
+
+#include <memory>
+
+#include <mfem.hpp>
+
+#include "AssemblyBase.h"
+
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Symmetric sparse matrix of which only the upper triangle is
+   * stored, in CSR format.
+   */
+  class SymmetricSparseMatrix : public mfem::Operator
+  {
+    public:
+      /**
+       * @brief Constructs the matrix from its upper triangle.
+       * @param[in] upper Finalized square matrix whose entries below the
+       * diagonal are zero
+       */
+      SymmetricSparseMatrix(mfem::SparseMatrix&& upper);
+
+      void Mult(const mfem::Vector& x, mfem::Vector& y) const override;
+
+      void MultTranspose(const mfem::Vector& x, mfem::Vector& y) const override
+      {
+        Mult(x, y);
+      }
+
+      /**
+       * @brief Gets the diagonal of the matrix.
+       */
+      void getDiagonal(mfem::Vector& d) const
+      {
+        m_upper.GetDiag(d);
+      }
+
+      /**
+       * @brief Gets the upper triangle of the matrix, including the
+       * diagonal.
+       */
+      const mfem::SparseMatrix& getUpper() const
+      {
+        return m_upper;
+      }
+
+      /**
+       * @brief Gets the number of stored nonzero entries.
+       */
+      size_t getNonZeros() const
+      {
+        return m_upper.NumNonZeroElems();
+      }
+
+    private:
+      mfem::SparseMatrix m_upper;
+  };
+}
+
+namespace Rodin::Variational::Assembly
+{
+  /**
+   * @brief Assembly of symmetric bilinear forms.
+   *
+   * If the trial and test spaces coincide, the element matrices of the
+   * symmetric integrators are only scattered into the upper triangle of the
+   * global matrix, which is stored as an Internal::SymmetricSparseMatrix.
+   * This halves the memory of the matrix and the work of the scatter. The
+   * remaining integrators are assembled by the Native policy into a sparse
+   * matrix which is added to the operator.
+   *
+   * @see BilinearFormIntegratorBase::isSymmetric()
+   */
+  template <>
+  class Symmetric<BilinearFormBase<mfem::Operator>>
+    : public AssemblyBase<BilinearFormBase<mfem::Operator>>
+  {
+    public:
+      using Parent = AssemblyBase<BilinearFormBase<mfem::Operator>>;
+      using OperatorType = mfem::Operator;
+
+      Symmetric() = default;
+
+      Symmetric(const Symmetric& other)
+        : Parent(other)
+      {}
+
+      Symmetric(Symmetric&& other)
+        : Parent(std::move(other))
+      {}
+
+      std::unique_ptr<OperatorType> execute(const Input& input) const override;
+
+      Symmetric* copy() const noexcept override
+      {
+        return new Symmetric(*this);
+      }
+  };
+}
+
+#endif
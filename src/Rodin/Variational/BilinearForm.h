@@ -7,6 +7,9 @@
 #ifndef RODIN_VARIATIONAL_BILINEARFORM_H
 #define RODIN_VARIATIONAL_BILINEARFORM_H
 
+#include <set>
+#include <optional>
+
 #include <mfem.hpp>
 
 #include "Rodin/FormLanguage/List.h"
@@ -15,6 +18,7 @@
 #include "TrialFunction.h"
 #include "TestFunction.h"
 #include "BilinearFormIntegrator.h"
+#include "Assembly/Incremental.h"
 
 
 namespace Rodin::Variational
@@ -52,6 +56,21 @@ namespace Rodin::Variational
         return m_bfis;
       }
 
+      /**
+       * @brief Determines if the bilinear form is symmetric, i.e. if all its
+       * integrators are symmetric.
+       * @see BilinearFormIntegratorBase::isSymmetric()
+       */
+      bool isSymmetric() const
+      {
+        for (const auto& bfi : m_bfis)
+        {
+          if (!bfi.isSymmetric())
+            return false;
+        }
+        return true;
+      }
+
       BilinearFormBase& setAssembly(const Assembly::AssemblyBase<BilinearFormBase>& assembly)
       {
         m_assembly.reset(assembly.copy());
@@ -191,13 +210,18 @@ namespace Rodin::Variational
       BilinearForm(const BilinearForm& other)
         : Parent(other),
           m_u(other.m_u), m_v(other.m_v)
-      {}
+      {
+        // The operator is not copied, hence neither are the contributions
+        if (other.m_incremental)
+          m_incremental.emplace();
+      }
 
       constexpr
       BilinearForm(BilinearForm&& other)
         : Parent(std::move(other)),
           m_u(std::move(other.m_u)), m_v(std::move(other.m_v)),
-          m_operator(std::move(other.m_operator))
+          m_operator(std::move(other.m_operator)),
+          m_incremental(std::move(other.m_incremental))
       {}
 
       /**
@@ -220,6 +244,79 @@ namespace Rodin::Variational
 
       void assemble() override;
 
+      /**
+       * @brief Enables or disables the incremental reassembly of the
+       * bilinear form.
+       *
+       * When enabled, assemble() records the contribution of each simplex
+       * to the matrix, whose sparsity pattern then covers all the simplices
+       * in the regions of the integrators. The matrix may afterwards be
+       * updated through reassemble(). The contributions are computed
+       * directly from the integrators, hence the assembly policy is not
+       * used.
+       *
+       * @returns Reference to this (for method chaining)
+       */
+      BilinearForm& setIncremental(bool incremental = true)
+      {
+        if (incremental)
+          m_incremental.emplace();
+        else
+          m_incremental.reset();
+        return *this;
+      }
+
+      bool isIncremental() const
+      {
+        return m_incremental.has_value();
+      }
+
+      /**
+       * @brief Marks the simplex for reassembly.
+       * @param[in] dimension Dimension of the simplex, i.e. the dimension
+       * of the elements or of the faces
+       * @param[in] index Index of the simplex
+       * @returns Reference to this (for method chaining)
+       *
+       * This is used to signal a change in the integrand which is not
+       * detected by reassemble(), e.g. a coefficient which changed over
+       * some elements.
+       */
+      BilinearForm& invalidate(size_t dimension, Index index)
+      {
+        assert(m_incremental);
+        m_incremental->invalidate(dimension, index);
+        return *this;
+      }
+
+      /**
+       * @brief Marks the simplices for reassembly.
+       * @returns Reference to this (for method chaining)
+       * @see invalidate(size_t, Index)
+       */
+      BilinearForm& invalidate(size_t dimension, const std::set<Index>& indices)
+      {
+        for (const Index i : indices)
+          invalidate(dimension, i);
+        return *this;
+      }
+
+      /**
+       * @brief Reassembles the contributions of the simplices which were
+       * invalidated, or whose attribute changed, since the last assembly.
+       *
+       * The stale contribution of each such simplex is subtracted from the
+       * matrix and the new one is added, so the cost is proportional to the
+       * number of reassembled simplices. A full assembly is performed
+       * instead if the form is not incremental, or if the geometry or the
+       * topology of the mesh, or the integrators, changed since the last
+       * assembly.
+       *
+       * @returns Number of reassembled simplices, i.e. all the simplices
+       * which some integrator contributes to in case of a full assembly
+       */
+      size_t reassemble();
+
       const TrialFunction<TrialFES>& getTrialFunction() const override
       {
         return m_u.get();
@@ -273,6 +370,122 @@ namespace Rodin::Variational
         return new BilinearForm(*this);
       }
 
+    private:
+      std::reference_wrapper<const TrialFunction<TrialFES>> m_u;
+      std::reference_wrapper<const TestFunction<TestFES>>   m_v;
+      std::unique_ptr<OperatorType> m_operator;
+      std::optional<Internal::IncrementalAssembly> m_incremental;
+  };
+
+  /**
+   * @brief Bilinear form whose operator is only accessed through its action.
+   *
+   * The representation of the operator is decided by the assembly policy.
+   * By default the form is assembled into a sparse matrix, while
+   * Assembly::MatrixFree applies the operator element by element without
+   * ever forming the matrix.
+   */
+  template <class TrialFES, class TestFES>
+  class BilinearForm<TrialFES, TestFES, Context::Serial, mfem::Operator> final
+    : public BilinearFormBase<mfem::Operator>
+  {
+    static_assert(
+        std::is_same_v<TrialFES, TestFES>,
+        "Different trial and test spaces are currently not supported.");
+
+    static_assert(std::is_same_v<typename TrialFES::Context, Context::Serial>);
+
+    public:
+      using Context = typename TrialFES::Context;
+      using OperatorType = mfem::Operator;
+      using Parent = BilinearFormBase<mfem::Operator>;
+
+      /**
+       * @brief Constructs a BilinearForm from a TrialFunction and
+       * TestFunction.
+       *
+       * @param[in] u Trial function argument
+       * @param[in] v Test function argument
+       */
+      constexpr
+      BilinearForm(const TrialFunction<TrialFES>& u, const TestFunction<TestFES>& v)
+        :  m_u(u), m_v(v)
+      {}
+
+      constexpr
+      BilinearForm(const BilinearForm& other)
+        : Parent(other),
+          m_u(other.m_u), m_v(other.m_v)
+      {}
+
+      constexpr
+      BilinearForm(BilinearForm&& other)
+        : Parent(std::move(other)),
+          m_u(std::move(other.m_u)), m_v(std::move(other.m_v)),
+          m_operator(std::move(other.m_operator))
+      {}
+
+      /**
+       * @brief Evaluates the bilinear form at the functions @f$ u @f$ and
+       * @f$ v @f$.
+       */
+      Scalar operator()(
+          const GridFunction<TrialFES>& u, const GridFunction<TestFES>& v) const
+      {
+        assert(m_operator);
+        mfem::Vector tmp(m_operator->Height());
+        m_operator->Mult(u.getHandle(), tmp);
+        return tmp * v.getHandle();
+      }
+
+      void assemble() override;
+
+      const TrialFunction<TrialFES>& getTrialFunction() const override
+      {
+        return m_u.get();
+      }
+
+      const TestFunction<TestFES>& getTestFunction() const override
+      {
+        return m_v.get();
+      }
+
+      BilinearForm& operator=(const BilinearFormIntegratorBase& bfi) override
+      {
+        from(bfi).assemble();
+        return *this;
+      }
+
+      BilinearForm& operator=(
+          const FormLanguage::List<BilinearFormIntegratorBase>& bfis) override
+      {
+        from(bfis).assemble();
+        return *this;
+      }
+
+      /**
+       * @brief Gets the reference to the associated operator.
+       */
+      virtual OperatorType& getOperator() override
+      {
+        assert(m_operator);
+        return *m_operator;
+      }
+
+      /**
+       * @brief Gets the constant reference to the associated operator.
+       */
+      virtual const OperatorType& getOperator() const override
+      {
+        assert(m_operator);
+        return *m_operator;
+      }
+
+      virtual BilinearForm* copy() const noexcept override
+      {
+        return new BilinearForm(*this);
+      }
+
     private:
       std::reference_wrapper<const TrialFunction<TrialFES>> m_u;
       std::reference_wrapper<const TestFunction<TestFES>>   m_v;
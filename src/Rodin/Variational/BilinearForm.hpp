@@ -29,9 +29,51 @@ namespace Rodin::Variational
       const auto& trialFes = getTrialFunction().getFiniteElementSpace();
       const auto& testFes = getTestFunction().getFiniteElementSpace();
       const auto& mesh = getTrialFunction().getFiniteElementSpace().getMesh();
-      m_operator.reset(
-            new OperatorType(
-               getAssembly().execute({mesh, trialFes, testFes, getIntegrators()})));
+      if (m_incremental)
+      {
+         m_operator.reset(
+               new OperatorType(
+                  m_incremental->assemble({mesh, trialFes, testFes, getIntegrators()})));
+      }
+      else
+      {
+         m_operator.reset(
+               new OperatorType(
+                  getAssembly().execute({mesh, trialFes, testFes, getIntegrators()})));
+      }
+   }
+
+   template <class TrialFES, class TestFES>
+   size_t
+   BilinearForm<TrialFES, TestFES, Context::Serial, mfem::SparseMatrix>::reassemble()
+   {
+      const auto& trialFes = getTrialFunction().getFiniteElementSpace();
+      const auto& testFes = getTestFunction().getFiniteElementSpace();
+      const auto& mesh = getTrialFunction().getFiniteElementSpace().getMesh();
+      const Internal::IncrementalAssembly::Input input = {mesh, trialFes, testFes, getIntegrators()};
+      if (!m_incremental)
+      {
+         assemble();
+         return Internal::IncrementalAssembly::count(input);
+      }
+      else if (!m_operator || !m_incremental->isCurrent(input))
+      {
+         assemble();
+         return m_incremental->getCount();
+      }
+      return m_incremental->update(input, *m_operator);
+   }
+
+   template <class TrialFES, class TestFES>
+   void
+   BilinearForm<TrialFES, TestFES, Context::Serial, mfem::Operator>::assemble()
+   {
+      assert(&getTrialFunction().getFiniteElementSpace().getMesh() ==
+            &getTestFunction().getFiniteElementSpace().getMesh());
+      const auto& trialFes = getTrialFunction().getFiniteElementSpace();
+      const auto& testFes = getTestFunction().getFiniteElementSpace();
+      const auto& mesh = getTrialFunction().getFiniteElementSpace().getMesh();
+      m_operator = getAssembly().execute({mesh, trialFes, testFes, getIntegrators()});
    }
 }
 
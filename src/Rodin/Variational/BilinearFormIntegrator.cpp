@@ -1,7 +1,15 @@
+#include <atomic>
+
 #include "BilinearFormIntegrator.h"
 
 namespace Rodin::Variational
 {
+  size_t BilinearFormIntegratorBase::generateRevision()
+  {
+    static std::atomic<size_t> s_revision(0);
+    return s_revision.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
   // std::unique_ptr<mfem::BilinearFormIntegrator> BilinearFormIntegratorBase::build() const
   // {
   //   return std::make_unique<Internal::ProxyBilinearFormIntegrator>(*this);
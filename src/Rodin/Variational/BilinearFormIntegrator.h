@@ -3,6 +3,7 @@
 
 #include <set>
 #include <memory>
+#include <optional>
 #include <mfem.hpp>
 
 #include "Rodin/FormLanguage/Base.h"
@@ -18,9 +19,42 @@ namespace Rodin::Variational
     public:
       using Parent = Integrator;
 
+      /**
+       * @brief Description of an integrand which is recognized as one of the
+       * standard bilinear forms with constant coefficients.
+       *
+       * Assembly policies may use this description to replace the element
+       * by element computation with a specialized one.
+       */
+      struct StandardForm
+      {
+        enum class Type
+        {
+          /// @f$ c \int u \cdot v \ dx @f$
+          Mass,
+
+          /// @f$ c \int \nabla u : \nabla v \ dx @f$
+          Diffusion,
+
+          /// @f$ \int \lambda (\nabla \cdot u)(\nabla \cdot v) + \mu (\nabla u + \nabla u^T) : \nabla v \ dx @f$
+          Elasticity
+        };
+
+        Type type;
+
+        /// Coefficient of the mass and diffusion forms.
+        Scalar coefficient = 1.0;
+
+        /// First Lamé coefficient of the elasticity form.
+        Scalar lambda = 0.0;
+
+        /// Second Lamé coefficient of the elasticity form.
+        Scalar mu = 0.0;
+      };
+
       template <class TrialFES, class TestFES>
       BilinearFormIntegratorBase(const TrialFunction<TrialFES>& u, const TestFunction<TestFES>& v)
-        : m_u(u), m_v(v)
+        : m_u(u), m_v(v), m_revision(generateRevision())
       {}
 
       template <class TrialFES, class TestFES>
@@ -35,13 +69,17 @@ namespace Rodin::Variational
       BilinearFormIntegratorBase(const BilinearFormIntegratorBase& other)
         : Parent(other),
           m_u(other.m_u), m_v(other.m_v),
-          m_attrs(other.m_attrs)
+          m_attrs(other.m_attrs),
+          m_order(other.m_order),
+          m_revision(generateRevision())
       {}
 
       BilinearFormIntegratorBase(BilinearFormIntegratorBase&& other)
         : Parent(std::move(other)),
           m_u(std::move(other.m_u)), m_v(std::move(other.m_v)),
-          m_attrs(std::move(other.m_attrs))
+          m_attrs(std::move(other.m_attrs)),
+          m_order(std::move(other.m_order)),
+          m_revision(other.m_revision)
       {}
 
       virtual
@@ -82,9 +120,52 @@ namespace Rodin::Variational
       {
         assert(attrs.size() > 0);
         m_attrs = attrs;
+        revise();
         return *this;
       }
 
+      /**
+       * @brief Sets the order of the quadrature rule used to integrate over
+       * each element.
+       * @returns Reference to self (for method chaining)
+       *
+       * By default the order is the sum of the orders of the finite
+       * elements and of the geometric transformation. A lower order uses fewer quadrature
+       * points, at the expense of accuracy. Integrators which compute the
+       * element matrices in closed form only do so if the order is not set.
+       */
+      inline
+      BilinearFormIntegratorBase& setQuadratureOrder(size_t order)
+      {
+        m_order = order;
+        revise();
+        return *this;
+      }
+
+      /**
+       * @brief Gets the order of the quadrature rule, if it was set.
+       */
+      inline
+      const std::optional<size_t>& getQuadratureOrder() const
+      {
+        return m_order;
+      }
+
+      /**
+       * @brief Gets the revision of the integrator.
+       *
+       * Every integrator, and every copy of an integrator, is given a
+       * revision which was never given before. The revision changes each
+       * time the integrator is modified, hence element matrices computed
+       * with the integrator are up to date as long as its revision does not
+       * change.
+       */
+      inline
+      size_t getRevision() const
+      {
+        return m_revision;
+      }
+
       inline
       Integrator::Type getType() const
       final override
@@ -117,13 +198,54 @@ namespace Rodin::Variational
       virtual
       Math::Matrix getMatrix(const Geometry::Simplex& element) const = 0;
 
+      /**
+       * @brief Gets the description of the integrand, if it is a standard
+       * form over a single finite element space.
+       *
+       * The default implementation returns an empty value, in which case the
+       * integrator must be assembled through getMatrix().
+       */
+      virtual
+      std::optional<StandardForm> getStandardForm() const
+      {
+        return std::nullopt;
+      }
+
+      /**
+       * @brief Determines if the element matrices of the integrator are
+       * symmetric.
+       *
+       * The default implementation considers symmetric the standard forms.
+       * @see getStandardForm()
+       */
+      virtual
+      bool isSymmetric() const
+      {
+        return getStandardForm().has_value();
+      }
+
       virtual
       BilinearFormIntegratorBase* copy() const noexcept override = 0;
 
+    protected:
+      /**
+       * @brief Gives a new revision to the integrator.
+       *
+       * Must be called by every method which modifies the integrand.
+       */
+      void revise()
+      {
+        m_revision = generateRevision();
+      }
+
     private:
+      static size_t generateRevision();
+
       std::reference_wrapper<const FormLanguage::Base> m_u;
       std::reference_wrapper<const FormLanguage::Base> m_v;
       std::set<Geometry::Attribute> m_attrs;
+      std::optional<size_t> m_order;
+      size_t m_revision;
   };
 }
 
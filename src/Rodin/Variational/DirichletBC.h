@@ -123,8 +123,13 @@ namespace Rodin::Variational
       inline
       const mfem::Array<int>& getDOFs() const override
       {
-        if (!m_dofs.has_value())
-          m_dofs.emplace(m_u.get().getFiniteElementSpace().getEssentialTrueDOFs(m_essBdr));
+        const auto& fes = m_u.get().getFiniteElementSpace();
+        if (!m_dofs.has_value() || !m_version.isCurrent(fes.getMesh()))
+        {
+          m_dofs.reset();
+          m_dofs.emplace(fes.getEssentialTrueDOFs(m_essBdr));
+          m_version.update(fes.getMesh());
+        }
         assert(m_dofs.has_value());
         return m_dofs.value();
       }
@@ -140,6 +145,8 @@ namespace Rodin::Variational
       std::unique_ptr<Value> m_value;
       std::set<Geometry::Attribute> m_essBdr;
       mutable std::optional<const mfem::Array<int>> m_dofs;
+      mutable Geometry::MeshVersion m_version{
+        Geometry::MeshBase::Data::Topology, Geometry::MeshBase::Data::Attributes };
   };
 
   template <class OperandDerived, class ValueDerived, ShapeFunctionSpaceType Space, class ... Ts>
@@ -83,7 +83,7 @@ namespace Rodin::Variational
       {
         const auto& fe = this->getFiniteElementSpace().getFiniteElement(p.getSimplex());
         const auto& inv = p.getJacobianInverse();
-        const Math::Vector& coords = p.getCoordinates(Geometry::Point::Coordinates::Reference);
+        const Math::Vector& coords = p.getReferenceCoordinates();
         const auto& div = fe.getDivergence(coords);
         const size_t n = fe.getComponentDOFs();
         const size_t rdim = p.getSimplex().getDimension();
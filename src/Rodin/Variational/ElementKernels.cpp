@@ -0,0 +1,327 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <array>
+#include <cmath>
+
+#include "Rodin/Geometry/Mesh.h"
+#include "Rodin/Geometry/AffineTransformation.h"
+
+#include "FiniteElementSpace.h"
+
+#include "ElementKernels.h"
+
+namespace Rodin::Variational::Internal
+{
+  namespace
+  {
+    constexpr Scalar factorial(size_t n)
+    {
+      return n <= 1 ? 1.0 : n * factorial(n - 1);
+    }
+
+    /**
+     * Computes the integral of the barycentric monomial of the given
+     * exponents over the simplex of unit measure.
+     */
+    Scalar getMoment(const std::array<size_t, 4>& exponents, size_t dimension)
+    {
+      size_t degree = 0;
+      Scalar res = factorial(dimension);
+      for (size_t k = 0; k < dimension + 1; k++)
+      {
+        degree += exponents[k];
+        res *= factorial(exponents[k]);
+      }
+      return res / factorial(dimension + degree);
+    }
+
+    /**
+     * Gets the edges of the reference simplex, in the order in which mfem
+     * numbers the edge degrees of freedom.
+     */
+    std::vector<std::pair<size_t, size_t>> getEdges(size_t dimension)
+    {
+      switch (dimension)
+      {
+        case 1:
+          return { { 0, 1 } };
+        case 2:
+          return { { 0, 1 }, { 1, 2 }, { 2, 0 } };
+        case 3:
+          return { { 0, 1 }, { 0, 2 }, { 0, 3 }, { 1, 2 }, { 1, 3 }, { 2, 3 } };
+        default:
+          assert(false);
+          return {};
+      }
+    }
+
+    /**
+     * Writes each P2 basis function as the homogeneous quadratic form
+     * @f$ \phi_p = \lambda^T Q^p \lambda @f$, making use of
+     * @f$ \sum_a \lambda_a = 1 @f$.
+     */
+    std::vector<Math::Matrix> getQuadraticForms(size_t dimension)
+    {
+      const size_t nv = dimension + 1;
+      std::vector<Math::Matrix> res;
+      for (size_t i = 0; i < nv; i++)
+      {
+        // lambda_i (2 lambda_i - 1) = lambda_i (2 lambda_i - sum_k lambda_k)
+        Math::Matrix q = Math::Matrix::Zero(nv, nv);
+        for (size_t k = 0; k < nv; k++)
+        {
+          q(i, k) -= 0.5;
+          q(k, i) -= 0.5;
+        }
+        q(i, i) += 2.0;
+        res.push_back(std::move(q));
+      }
+      for (const auto& [i, j] : getEdges(dimension))
+      {
+        // 4 lambda_i lambda_j
+        Math::Matrix q = Math::Matrix::Zero(nv, nv);
+        q(i, j) = 2.0;
+        q(j, i) = 2.0;
+        res.push_back(std::move(q));
+      }
+      return res;
+    }
+  }
+
+  bool ElementKernels::isSupported(const Geometry::Simplex& simplex, const FiniteElementSpaceBase& fes)
+  {
+    const auto& mesh = simplex.getMesh();
+    if (simplex.getDimension() != mesh.getDimension())
+      return false;
+    if (mesh.getDimension() != mesh.getSpaceDimension())
+      return false;
+    switch (simplex.getGeometry())
+    {
+      case Geometry::Type::Segment:
+      case Geometry::Type::Triangle:
+      case Geometry::Type::Tetrahedron:
+        break;
+      default:
+        return false;
+    }
+
+    // Curved meshes carry a nodal grid function
+    if (mesh.getHandle().GetNodes())
+      return false;
+
+    const auto* fec = dynamic_cast<const mfem::H1_FECollection*>(fes.getHandle().FEColl());
+    if (!fec)
+      return false;
+
+    switch (fes.getOrder(simplex))
+    {
+      case 1:
+        return true;
+      case 2:
+        return fec->GetBasisType() != mfem::BasisType::Positive;
+      default:
+        return false;
+    }
+  }
+
+  ElementKernels::AffineSimplex ElementKernels::getAffineSimplex(const Geometry::Simplex& simplex)
+  {
+    const size_t d = simplex.getDimension();
+    Math::Matrix inverse;
+    Scalar determinant;
+    const auto* affine =
+      dynamic_cast<const Geometry::AffineTransformation*>(&simplex.getTransformation());
+    if (affine)
+    {
+      // The mesh already stores the transformation of the simplex
+      inverse = affine->getInverse();
+      determinant = affine->getDeterminant();
+    }
+    else
+    {
+      const auto& mesh = simplex.getMesh().getHandle();
+      const auto& vertices = simplex.getVertices();
+      assert(vertices.size() == d + 1);
+      Math::Matrix jacobian(d, d);
+      const Scalar* x0 = mesh.GetVertex(vertices[0]);
+      for (size_t k = 1; k < d + 1; k++)
+      {
+        const Scalar* xk = mesh.GetVertex(vertices[k]);
+        for (size_t i = 0; i < d; i++)
+          jacobian(i, k - 1) = xk[i] - x0[i];
+      }
+      inverse = jacobian.inverse();
+      determinant = jacobian.determinant();
+    }
+    AffineSimplex res;
+    res.gradients.resize(d + 1, d);
+    res.gradients.bottomRows(d) = inverse;
+    res.gradients.row(0) = -inverse.colwise().sum();
+    res.volume = std::abs(determinant) / factorial(d);
+    return res;
+  }
+
+  Math::Matrix ElementKernels::getMassMatrix(size_t order, const AffineSimplex& simplex)
+  {
+    const auto& tables = getTables(order, simplex.gradients.cols());
+    return simplex.volume * tables.mass;
+  }
+
+  Math::Matrix ElementKernels::getStiffnessMatrix(size_t order, const AffineSimplex& simplex)
+  {
+    const auto& tables = getTables(order, simplex.gradients.cols());
+    const size_t n = tables.mass.rows();
+    const Math::Matrix g = simplex.gradients * simplex.gradients.transpose();
+    const Math::Vector k =
+      simplex.volume * tables.gradient * Eigen::Map<const Math::Vector>(g.data(), g.size());
+    return Eigen::Map<const Math::Matrix>(k.data(), n, n);
+  }
+
+  Math::Matrix ElementKernels::getElasticityMatrix(
+      size_t order, const AffineSimplex& simplex, Scalar lambda, Scalar mu)
+  {
+    const auto& tables = getTables(order, simplex.gradients.cols());
+    const auto& gradients = simplex.gradients;
+    const size_t d = gradients.cols();
+    const size_t nv = d + 1;
+    const size_t n = tables.mass.rows();
+
+    // H_{(a, b), (i, j)} = d_i lambda_a d_j lambda_b
+    Math::Matrix h(nv * nv, d * d);
+    for (size_t j = 0; j < d; j++)
+      for (size_t i = 0; i < d; i++)
+        for (size_t b = 0; b < nv; b++)
+          for (size_t a = 0; a < nv; a++)
+            h(a + nv * b, i + d * j) = gradients(a, i) * gradients(b, j);
+
+    // S_{(p, q), (i, j)} = int_K d_i phi_p d_j phi_q dx
+    const Math::Matrix s = simplex.volume * tables.gradient * h;
+
+    Math::Matrix res(d * n, d * n);
+    for (size_t q = 0; q < n; q++)
+    {
+      for (size_t p = 0; p < n; p++)
+      {
+        const size_t pq = p + n * q;
+        Scalar trace = 0;
+        for (size_t k = 0; k < d; k++)
+          trace += s(pq, k + d * k);
+        for (size_t j = 0; j < d; j++)
+        {
+          for (size_t i = 0; i < d; i++)
+          {
+            res(i * n + p, j * n + q) =
+              lambda * s(pq, i + d * j) + mu * s(pq, j + d * i) + (i == j ? mu * trace : 0.0);
+          }
+        }
+      }
+    }
+    return res;
+  }
+
+  const ElementKernels::Tables& ElementKernels::getTables(size_t order, size_t dimension)
+  {
+    assert(order == 1 || order == 2);
+    assert(1 <= dimension && dimension <= 3);
+    static const std::array<std::array<Tables, 3>, 2> s_tables =
+      []()
+      {
+        std::array<std::array<Tables, 3>, 2> res;
+        for (size_t o = 0; o < 2; o++)
+          for (size_t d = 0; d < 3; d++)
+            res[o][d] = computeTables(o + 1, d + 1);
+        return res;
+      }();
+    return s_tables[order - 1][dimension - 1];
+  }
+
+  ElementKernels::Tables ElementKernels::computeTables(size_t order, size_t dimension)
+  {
+    const size_t nv = dimension + 1;
+    Tables res;
+    if (order == 1)
+    {
+      const size_t n = nv;
+      res.mass.resize(n, n);
+      res.gradient = Math::Matrix::Zero(n * n, nv * nv);
+      for (size_t q = 0; q < n; q++)
+      {
+        for (size_t p = 0; p < n; p++)
+        {
+          std::array<size_t, 4> exponents = {};
+          exponents[p]++;
+          exponents[q]++;
+          res.mass(p, q) = getMoment(exponents, dimension);
+          res.gradient(p + n * q, p + nv * q) = 1.0;
+        }
+      }
+    }
+    else
+    {
+      assert(order == 2);
+      const auto forms = getQuadraticForms(dimension);
+      const size_t n = forms.size();
+
+      // Moments of degree two, which are the only ones required by the
+      // gradients since they are linear in the barycentric coordinates.
+      Math::Matrix m2(nv, nv);
+      for (size_t l = 0; l < nv; l++)
+      {
+        for (size_t k = 0; k < nv; k++)
+        {
+          std::array<size_t, 4> exponents = {};
+          exponents[k]++;
+          exponents[l]++;
+          m2(k, l) = getMoment(exponents, dimension);
+        }
+      }
+
+      res.mass = Math::Matrix::Zero(n, n);
+      res.gradient = Math::Matrix::Zero(n * n, nv * nv);
+      for (size_t q = 0; q < n; q++)
+      {
+        const auto& qq = forms[q];
+        for (size_t p = 0; p < n; p++)
+        {
+          const auto& qp = forms[p];
+
+          // grad phi_p = sum_a 2 (Q^p lambda)_a grad lambda_a
+          const Math::Matrix r = 4.0 * qp * m2 * qq.transpose();
+          for (size_t b = 0; b < nv; b++)
+            for (size_t a = 0; a < nv; a++)
+              res.gradient(p + n * q, a + nv * b) = r(a, b);
+
+          Scalar mass = 0;
+          for (size_t a = 0; a < nv; a++)
+          {
+            for (size_t b = 0; b < nv; b++)
+            {
+              if (qp(a, b) == 0.0)
+                continue;
+              for (size_t c = 0; c < nv; c++)
+              {
+                for (size_t e = 0; e < nv; e++)
+                {
+                  if (qq(c, e) == 0.0)
+                    continue;
+                  std::array<size_t, 4> exponents = {};
+                  exponents[a]++;
+                  exponents[b]++;
+                  exponents[c]++;
+                  exponents[e]++;
+                  mass += qp(a, b) * qq(c, e) * getMoment(exponents, dimension);
+                }
+              }
+            }
+          }
+          res.mass(p, q) = mass;
+        }
+      }
+    }
+    return res;
+  }
+}
@@ -0,0 +1,140 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_VARIATIONAL_ELEMENTKERNELS_H
+#define RODIN_VARIATIONAL_ELEMENTKERNELS_H
+
+#include <optional>
+#include <type_traits>
+
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/Matrix.h"
+#include "Rodin/Geometry/Simplex.h"
+
+#include "ForwardDecls.h"
+#include "ScalarFunction.h"
+
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Closed-form element matrices of the P1 and P2 Lagrange elements
+   * on affine simplices.
+   *
+   * On an affine simplex @f$ K \subset \mathbb{R}^d @f$ the gradients of the
+   * barycentric coordinates @f$ \lambda_0, \ldots, \lambda_d @f$ are
+   * constant. Writing the P1 and P2 basis functions as polynomials in the
+   * barycentric coordinates, the element matrices become contractions of
+   * the metric @f$ g_{ab} = \nabla \lambda_a \cdot \nabla \lambda_b @f$
+   * with reference tables which do not depend on @f$ K @f$. The latter are
+   * computed once, exactly, from:
+   * @f[
+   *   \int_K \lambda^\alpha \ dx = |K| \dfrac{d! \ \alpha!}{(d + |\alpha|)!}
+   * @f]
+   * so that the cost per element reduces to a single small matrix-vector
+   * product, with no quadrature loop and no basis evaluation.
+   */
+  class ElementKernels
+  {
+    public:
+      /**
+       * @brief Geometric data of an affine simplex.
+       */
+      struct AffineSimplex
+      {
+        /// Gradients of the barycentric coordinates, stored by rows.
+        Math::Matrix gradients;
+
+        /// Measure of the simplex.
+        Scalar volume;
+      };
+
+      /**
+       * @brief Determines if the closed-form kernels apply to the given
+       * simplex and finite element space.
+       *
+       * The simplex must be a segment, triangle or tetrahedron of full
+       * dimension on a mesh with affine geometry, and the space must be a
+       * Lagrange space of order one or two whose nodes are the vertices and
+       * edge midpoints.
+       */
+      static bool isSupported(const Geometry::Simplex& simplex, const FiniteElementSpaceBase& fes);
+
+      static AffineSimplex getAffineSimplex(const Geometry::Simplex& simplex);
+
+      /**
+       * @brief Computes the element matrix of @f$ \int_K u v \ dx @f$.
+       */
+      static Math::Matrix getMassMatrix(size_t order, const AffineSimplex& simplex);
+
+      /**
+       * @brief Computes the element matrix of
+       * @f$ \int_K \nabla u \cdot \nabla v \ dx @f$.
+       */
+      static Math::Matrix getStiffnessMatrix(size_t order, const AffineSimplex& simplex);
+
+      /**
+       * @brief Computes the element matrix of
+       * @f[
+       *   \int_K \lambda (\nabla \cdot u) (\nabla \cdot v)
+       *   + \mu (\nabla u + \nabla u^T) : \nabla v \ dx
+       * @f]
+       * for a vector valued space with as many components as the dimension
+       * of the simplex, in the byNODES ordering of the element DOFs.
+       */
+      static Math::Matrix getElasticityMatrix(
+          size_t order, const AffineSimplex& simplex, Scalar lambda, Scalar mu);
+
+      /**
+       * @brief Gets the value of a function if it is known to be constant
+       * over the whole mesh.
+       *
+       * A coefficient which is constant on each attribute is written as a
+       * sum of integrals restricted with over(), each one with a constant
+       * coefficient, which then all use the closed-form kernels.
+       */
+      template <class Derived>
+      static std::optional<Scalar> getConstant(const FunctionBase<Derived>& f)
+      {
+        if constexpr (std::is_same_v<Derived, ScalarFunctionBase<ScalarFunction<Scalar>>>)
+        {
+          return static_cast<const ScalarFunction<Scalar>&>(f).getValue();
+        }
+        else if constexpr (std::is_same_v<Derived, ScalarFunctionBase<ScalarFunction<Integer>>>)
+        {
+          return static_cast<const ScalarFunction<Integer>&>(f).getValue();
+        }
+        else
+        {
+          return std::nullopt;
+        }
+      }
+
+    private:
+      struct Tables
+      {
+        /// Mass matrix of the simplex of unit measure.
+        Math::Matrix mass;
+
+        /**
+         * Contraction table @f$ R @f$ of size @f$ n^2 \times (d + 1)^2 @f$
+         * such that
+         * @f[
+         *   \int_K \partial_i \phi_p \partial_j \phi_q \ dx
+         *    = |K| \sum_{a, b} R_{(p, q), (a, b)}
+         *      \partial_i \lambda_a \partial_j \lambda_b.
+         * @f]
+         */
+        Math::Matrix gradient;
+      };
+
+      static const Tables& getTables(size_t order, size_t dimension);
+
+      static Tables computeTables(size_t order, size_t dimension);
+  };
+}
+
+#endif
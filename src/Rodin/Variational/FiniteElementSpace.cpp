@@ -6,6 +6,36 @@
  */
 #include "FiniteElementSpace.h"
 
+namespace Rodin::Variational::Internal
+{
+  DOFTable::DOFTable(const Geometry::MeshBase& mesh, const mfem::FiniteElementSpace& fes)
+    : m_dimension(mesh.getDimension())
+  {
+    assert(&mesh.getHandle() == fes.GetMesh());
+    m_version.update(mesh);
+    mfem::Array<int> dofs;
+    for (size_t k = 0; k < 2; k++)
+    {
+      const size_t count = k == 0 ? fes.GetNE() : fes.GetNF();
+      std::vector<size_t> offsets(count + 1, 0);
+      for (size_t i = 0; i < count; i++)
+      {
+        if (k == 0)
+          fes.GetElementVDofs(i, dofs);
+        else
+          fes.GetFaceVDofs(i, dofs);
+        m_dofs[k].insert(m_dofs[k].end(), dofs.begin(), dofs.end());
+        offsets[i + 1] = m_dofs[k].size();
+      }
+
+      // The table is complete, hence the views will not be invalidated
+      m_views[k].reserve(count);
+      for (size_t i = 0; i < count; i++)
+        m_views[k].emplace_back(m_dofs[k].data() + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+  }
+}
+
 namespace Rodin::Variational
 {
   size_t FiniteElementSpaceBase::getVectorDimension() const
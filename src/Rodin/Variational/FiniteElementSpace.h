@@ -7,6 +7,8 @@
 #ifndef RODIN_VARIATIONAL_FINITEELEMENTSPACE_H
 #define RODIN_VARIATIONAL_FINITEELEMENTSPACE_H
 
+#include <array>
+#include <vector>
 #include <variant>
 
 #include <mfem.hpp>
@@ -17,6 +19,64 @@
 #include "ForwardDecls.h"
 #include "FiniteElement.h"
 
+namespace Rodin::Variational::Internal
+{
+  /**
+   * @internal
+   * @brief Flat tables of the vector DOFs of the elements and of the faces
+   * of a finite element space.
+   *
+   * The DOFs of all the simplices of the same dimension are stored
+   * contiguously. Each simplex is given a non owning mfem::Array<int> which
+   * views its range of the table, so that it may be passed to the mfem
+   * assembly routines without any allocation or copy.
+   */
+  class DOFTable
+  {
+    public:
+      DOFTable() = default;
+
+      /**
+       * @brief Builds the table of the space, which must be defined on the
+       * given mesh.
+       */
+      DOFTable(const Geometry::MeshBase& mesh, const mfem::FiniteElementSpace& fes);
+
+      DOFTable(const DOFTable&) = delete;
+
+      DOFTable(DOFTable&&) = default;
+
+      DOFTable& operator=(DOFTable&&) = default;
+
+      /**
+       * @brief Gets the vector DOFs of the element or face of the given
+       * index.
+       */
+      const mfem::Array<int>& get(size_t dimension, Index idx) const
+      {
+        assert(dimension == m_dimension || dimension + 1 == m_dimension);
+        const auto& views = m_views[m_dimension - dimension];
+        assert(idx < views.size());
+        return views[idx];
+      }
+
+      /**
+       * @brief Determines if the table was built on the current topology of
+       * the mesh.
+       */
+      bool isCurrent(const Geometry::MeshBase& mesh) const
+      {
+        return m_version.isCurrent(mesh);
+      }
+
+    private:
+      Geometry::MeshVersion m_version{ Geometry::MeshBase::Data::Topology };
+      size_t m_dimension;
+      std::array<std::vector<int>, 2> m_dofs;
+      std::array<std::vector<mfem::Array<int>>, 2> m_views;
+  };
+}
+
 namespace Rodin::Variational
 {
   class FiniteElementSpaceBase
@@ -58,7 +118,14 @@ namespace Rodin::Variational
 
       virtual size_t getSize() const = 0;
 
-      virtual mfem::Array<int> getDOFs(const Geometry::Simplex& element) const = 0;
+      /**
+       * @brief Gets the vector DOFs of the element or face.
+       *
+       * The returned array views a table which is built on construction and
+       * lives as long as the finite element space. The space must be built
+       * again once the topology of its mesh changed.
+       */
+      virtual const mfem::Array<int>& getDOFs(const Geometry::Simplex& element) const = 0;
 
       virtual const Geometry::MeshBase& getMesh() const = 0;
 
@@ -876,6 +876,18 @@ namespace Rodin::Variational
 
     template <class Operand>
     class OpenMP;
+
+    template <class Operand>
+    class MatrixFree;
+
+    template <class Operand>
+    class Partial;
+
+    template <class Operand>
+    class Symmetric;
+
+    template <class Operand>
+    class Block;
   }
 
   class ShapeComputator;
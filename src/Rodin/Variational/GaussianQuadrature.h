@@ -5,11 +5,44 @@
 #include "ForwardDecls.h"
 #include "ShapeFunction.h"
 #include "QuadratureRule.h"
+#include "ElementKernels.h"
 #include "LinearFormIntegrator.h"
 #include "BilinearFormIntegrator.h"
 
 namespace Rodin::Variational
 {
+  namespace Internal
+  {
+    /**
+     * @internal
+     * @brief Computes the element matrix of the dot product of a trial and
+     * test operator by Gaussian quadrature.
+     *
+     * @param[in] order Order of the quadrature rule. If empty, the sum of the
+     * orders of the finite elements and of the transformation is used.
+     */
+    template <class LHS, class RHS>
+    Math::Matrix integrate(
+        const Dot<LHS, RHS>& integrand, const Geometry::Simplex& simplex,
+        const std::optional<size_t>& order = {})
+    {
+      const auto& trial = integrand.getLHS();
+      const auto& test = integrand.getRHS();
+      const auto& trans = simplex.getTransformation();
+      const QuadratureRule& qr = QuadratureRule::get(simplex.getGeometry(), order.value_or(
+            trial.getFiniteElementSpace().getOrder(simplex) +
+            test.getFiniteElementSpace().getOrder(simplex) +
+            trans.getDistortionOrder()));
+      Math::Matrix res = Math::Matrix::Zero(test.getDOFs(simplex), trial.getDOFs(simplex));
+      for (size_t i = 0; i < qr.size(); i++)
+      {
+        Geometry::Point p(simplex, trans, qr.getPoint(i));
+        res += qr.getWeight(i) * p.getDistortion() * integrand.getMatrix(p);
+      }
+      return res;
+    }
+  }
+
   /**
    * @defgroup GaussianQuadratureSpecializations GaussianQuadrature Template Specializations
    * @brief Template specializations of the GaussianQuadrature class.
@@ -57,22 +90,7 @@ namespace Rodin::Variational
 
       Math::Matrix getMatrix(const Geometry::Simplex& simplex) const final override
       {
-        const auto& integrand = getIntegrand();
-        const auto& trial = integrand.getLHS();
-        const auto& test = integrand.getRHS();
-        const auto& trans = simplex.getTransformation();
-        const size_t order =
-          trial.getFiniteElementSpace().getOrder(simplex) +
-          test.getFiniteElementSpace().getOrder(simplex) +
-          simplex.getTransformation().getHandle().OrderW();
-        const QuadratureRule& qr = QuadratureRule::get(simplex.getGeometry(), order);
-        Math::Matrix res = Math::Matrix::Zero(test.getDOFs(simplex), trial.getDOFs(simplex));
-        for (size_t i = 0; i < qr.size(); i++)
-        {
-          Geometry::Point p(simplex, trans, qr.getPoint(i));
-          res += qr.getWeight(i) * p.getDistortion() * integrand.getMatrix(p);
-        }
-        return res;
+        return Internal::integrate(getIntegrand(), simplex, getQuadratureOrder());
       }
 
       virtual Region getRegion() const override = 0;
@@ -128,8 +146,8 @@ namespace Rodin::Variational
         const auto& integrand = getIntegrand();
         assert(integrand.getRangeType() == RangeType::Scalar);
         const auto& trans = simplex.getTransformation();
-        const size_t order =
-          integrand.getFiniteElementSpace().getOrder(simplex) + trans.getHandle().OrderW();
+        const size_t order = getQuadratureOrder().value_or(
+          integrand.getFiniteElementSpace().getOrder(simplex) + trans.getDistortionOrder());
         Math::Vector res = Math::Vector::Zero(integrand.getDOFs(simplex));
         const QuadratureRule& qr = QuadratureRule::get(simplex.getGeometry(), order);
         for (size_t i = 0; i < qr.size(); i++)
@@ -202,17 +220,34 @@ namespace Rodin::Variational
 
       Math::Matrix getMatrix(const Geometry::Simplex& simplex) const override
       {
-        const auto& fe = getIntegrand().getLHS()
-                                       .getFiniteElementSpace()
-                                       .getFiniteElement(simplex);
+        const auto& trialFES = getIntegrand().getLHS().getFiniteElementSpace();
+        const auto& testFES = getIntegrand().getRHS().getFiniteElementSpace();
+        const auto& order = getQuadratureOrder();
+        if (!order && trialFES == testFES && Internal::ElementKernels::isSupported(simplex, trialFES))
+        {
+          return Internal::ElementKernels::getStiffnessMatrix(
+              trialFES.getOrder(simplex), Internal::ElementKernels::getAffineSimplex(simplex));
+        }
+        const auto& fe = trialFES.getFiniteElement(simplex);
         Math::Matrix res(fe.getDOFs(), fe.getDOFs());
         mfem::DenseMatrix tmp(res.data(), res.rows(), res.cols());
         mfem::ConstantCoefficient one(1.0);
         mfem::DiffusionIntegrator bfi(one);
-        bfi.AssembleElementMatrix(fe.getHandle(), simplex.getTransformation().getHandle(), tmp);
+        if (order)
+          bfi.SetIntRule(&QuadratureRule::get(simplex.getGeometry(), *order).getHandle());
+        mfem::IsoparametricTransformation storage;
+        bfi.AssembleElementMatrix(fe.getHandle(), simplex.getTransformation().getHandle(storage), tmp);
         return res;
       }
 
+      std::optional<StandardForm> getStandardForm() const override
+      {
+        const auto& integrand = getIntegrand();
+        if (integrand.getLHS().getFiniteElementSpace() == integrand.getRHS().getFiniteElementSpace())
+          return StandardForm{ StandardForm::Type::Diffusion };
+        return std::nullopt;
+      }
+
       virtual Region getRegion() const override = 0;
 
       virtual GaussianQuadrature* copy() const noexcept override = 0;
@@ -229,6 +264,181 @@ namespace Rodin::Variational
         ShapeFunctionBase<Grad<ShapeFunction<LHSDerived, TrialFES, TrialSpace>>, TrialFES, TrialSpace>,
         ShapeFunctionBase<Grad<ShapeFunction<RHSDerived, TestFES, TestSpace>>, TestFES, TestSpace>>>;
 
+  /**
+   * @ingroup GaussianQuadratureSpecializations
+   *
+   * @f[
+   * \int f \nabla u \cdot \nabla v \ dx
+   * @f]
+   * where @f$ f @f$ is a scalar function.
+   */
+  template <class CoefficientDerived, class LHSDerived, class TrialFES, class RHSDerived, class TestFES>
+  class GaussianQuadrature<Dot<
+        ShapeFunctionBase<
+          Mult<FunctionBase<CoefficientDerived>,
+            ShapeFunctionBase<Grad<ShapeFunction<LHSDerived, TrialFES, TrialSpace>>, TrialFES, TrialSpace>>,
+          TrialFES, TrialSpace>,
+        ShapeFunctionBase<Grad<ShapeFunction<RHSDerived, TestFES, TestSpace>>, TestFES, TestSpace>>>
+    : public BilinearFormIntegratorBase
+  {
+    public:
+      using Parent = BilinearFormIntegratorBase;
+      using LHS = ShapeFunctionBase<
+        Mult<FunctionBase<CoefficientDerived>,
+          ShapeFunctionBase<Grad<ShapeFunction<LHSDerived, TrialFES, TrialSpace>>, TrialFES, TrialSpace>>,
+        TrialFES, TrialSpace>;
+      using RHS = ShapeFunctionBase<Grad<ShapeFunction<RHSDerived, TestFES, TestSpace>>, TestFES, TestSpace>;
+      using Integrand = Dot<LHS, RHS>;
+
+      constexpr
+      GaussianQuadrature(const Integrand& integrand)
+        : BilinearFormIntegratorBase(integrand.getLHS().getLeaf(), integrand.getRHS().getLeaf()),
+          m_integrand(integrand.copy())
+      {}
+
+      constexpr
+      GaussianQuadrature(const GaussianQuadrature& other)
+        : Parent(other),
+          m_integrand(other.m_integrand->copy())
+      {}
+
+      constexpr
+      GaussianQuadrature(GaussianQuadrature&& other)
+        : Parent(std::move(other)),
+          m_integrand(std::move(other.m_integrand))
+      {}
+
+      inline
+      constexpr
+      const Integrand& getIntegrand() const
+      {
+        assert(m_integrand);
+        return *m_integrand;
+      }
+
+      Math::Matrix getMatrix(const Geometry::Simplex& simplex) const override
+      {
+        const auto& integrand = getIntegrand();
+        const auto& trialFES = integrand.getLHS().getFiniteElementSpace();
+        const auto& testFES = integrand.getRHS().getFiniteElementSpace();
+        const auto& mult = static_cast<const Mult<FunctionBase<CoefficientDerived>,
+          ShapeFunctionBase<Grad<ShapeFunction<LHSDerived, TrialFES, TrialSpace>>, TrialFES, TrialSpace>>&>(
+              integrand.getLHS());
+        const auto f = Internal::ElementKernels::getConstant(mult.getLHS());
+        if (f && !getQuadratureOrder() && trialFES == testFES
+            && Internal::ElementKernels::isSupported(simplex, trialFES))
+        {
+          return *f * Internal::ElementKernels::getStiffnessMatrix(
+              trialFES.getOrder(simplex), Internal::ElementKernels::getAffineSimplex(simplex));
+        }
+        return Internal::integrate(integrand, simplex, getQuadratureOrder());
+      }
+
+      std::optional<StandardForm> getStandardForm() const override
+      {
+        const auto& integrand = getIntegrand();
+        const auto& mult = static_cast<const Mult<FunctionBase<CoefficientDerived>,
+          ShapeFunctionBase<Grad<ShapeFunction<LHSDerived, TrialFES, TrialSpace>>, TrialFES, TrialSpace>>&>(
+              integrand.getLHS());
+        const auto f = Internal::ElementKernels::getConstant(mult.getLHS());
+        if (f && integrand.getLHS().getFiniteElementSpace() == integrand.getRHS().getFiniteElementSpace())
+          return StandardForm{ StandardForm::Type::Diffusion, *f };
+        return std::nullopt;
+      }
+
+      bool isSymmetric() const override
+      {
+        const auto& integrand = getIntegrand();
+        const auto& mult = static_cast<const Mult<FunctionBase<CoefficientDerived>,
+          ShapeFunctionBase<Grad<ShapeFunction<LHSDerived, TrialFES, TrialSpace>>, TrialFES, TrialSpace>>&>(
+              integrand.getLHS());
+        return mult.getLHS().getRangeType() == RangeType::Scalar
+          && integrand.getLHS().getFiniteElementSpace() == integrand.getRHS().getFiniteElementSpace();
+      }
+
+      virtual Region getRegion() const override = 0;
+
+      virtual GaussianQuadrature* copy() const noexcept override = 0;
+
+    private:
+      std::unique_ptr<Integrand> m_integrand;
+  };
+
+  /**
+   * @ingroup GaussianQuadratureSpecializations
+   *
+   * @f[
+   * \int u v \ dx
+   * @f]
+   */
+  template <class LHSDerived, class TrialFES, class RHSDerived, class TestFES>
+  class GaussianQuadrature<Dot<
+        ShapeFunctionBase<ShapeFunction<LHSDerived, TrialFES, TrialSpace>, TrialFES, TrialSpace>,
+        ShapeFunctionBase<ShapeFunction<RHSDerived, TestFES, TestSpace>, TestFES, TestSpace>>>
+    : public BilinearFormIntegratorBase
+  {
+    public:
+      using Parent = BilinearFormIntegratorBase;
+      using LHS = ShapeFunctionBase<ShapeFunction<LHSDerived, TrialFES, TrialSpace>, TrialFES, TrialSpace>;
+      using RHS = ShapeFunctionBase<ShapeFunction<RHSDerived, TestFES, TestSpace>, TestFES, TestSpace>;
+      using Integrand = Dot<LHS, RHS>;
+
+      constexpr
+      GaussianQuadrature(const Integrand& integrand)
+        : BilinearFormIntegratorBase(integrand.getLHS().getLeaf(), integrand.getRHS().getLeaf()),
+          m_integrand(integrand.copy())
+      {}
+
+      constexpr
+      GaussianQuadrature(const GaussianQuadrature& other)
+        : Parent(other),
+          m_integrand(other.m_integrand->copy())
+      {}
+
+      constexpr
+      GaussianQuadrature(GaussianQuadrature&& other)
+        : Parent(std::move(other)),
+          m_integrand(std::move(other.m_integrand))
+      {}
+
+      inline
+      constexpr
+      const Integrand& getIntegrand() const
+      {
+        assert(m_integrand);
+        return *m_integrand;
+      }
+
+      Math::Matrix getMatrix(const Geometry::Simplex& simplex) const override
+      {
+        const auto& integrand = getIntegrand();
+        const auto& trialFES = integrand.getLHS().getFiniteElementSpace();
+        const auto& testFES = integrand.getRHS().getFiniteElementSpace();
+        if (!getQuadratureOrder() && trialFES == testFES && trialFES.getVectorDimension() == 1
+            && Internal::ElementKernels::isSupported(simplex, trialFES))
+        {
+          return Internal::ElementKernels::getMassMatrix(
+              trialFES.getOrder(simplex), Internal::ElementKernels::getAffineSimplex(simplex));
+        }
+        return Internal::integrate(integrand, simplex, getQuadratureOrder());
+      }
+
+      std::optional<StandardForm> getStandardForm() const override
+      {
+        const auto& integrand = getIntegrand();
+        if (integrand.getLHS().getFiniteElementSpace() == integrand.getRHS().getFiniteElementSpace())
+          return StandardForm{ StandardForm::Type::Mass };
+        return std::nullopt;
+      }
+
+      virtual Region getRegion() const override = 0;
+
+      virtual GaussianQuadrature* copy() const noexcept override = 0;
+
+    private:
+      std::unique_ptr<Integrand> m_integrand;
+  };
+
   // /**
   //  * @ingroup IntegralSpecializations
   //  *
@@ -89,8 +89,10 @@ namespace Rodin::Variational
         mfem::Vector tmp(grad.data(), grad.size());
         if (simplex.getDimension() == fesMesh.getDimension())
         {
-          const auto& trans = p.getTransformation();
-          m_u.get().getHandle().GetGradient(trans.getHandle(), tmp);
+          mfem::IsoparametricTransformation storage;
+          auto& trans = p.getTransformation().getHandle(storage);
+          trans.SetIntPoint(&p.getIntegrationPoint());
+          m_u.get().getHandle().GetGradient(trans, tmp);
           return grad;
         }
         else if (simplex.getDimension() == fesMesh.getDimension() - 1)
@@ -105,7 +107,7 @@ namespace Rodin::Variational
             assert(submesh.getParent() == fesMesh);
             if (ft->Elem1 && this->getTraceDomain().count(ft->Elem1->Attribute))
             {
-              Geometry::Index parentIdx = submesh.getElementMap().left.at(ft->Elem1No);
+              Geometry::Index parentIdx = submesh.getElementMap().getParent(ft->Elem1No);
               ft->Elem1->ElementNo = parentIdx;
               ft->Elem1No = parentIdx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -114,7 +116,7 @@ namespace Rodin::Variational
             }
             else if (ft->Elem2 && this->getTraceDomain().count(ft->Elem2->Attribute))
             {
-              Geometry::Index parentIdx = submesh.getElementMap().left.at(ft->Elem2No);
+              Geometry::Index parentIdx = submesh.getElementMap().getParent(ft->Elem2No);
               ft->Elem2->ElementNo = parentIdx;
               ft->Elem2No = parentIdx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -124,7 +126,7 @@ namespace Rodin::Variational
             else if (face.isBoundary())
             {
               assert(ft->Elem1);
-              Geometry::Index parentIdx = submesh.getElementMap().left.at(ft->Elem1No);
+              Geometry::Index parentIdx = submesh.getElementMap().getParent(ft->Elem1No);
               ft->Elem1->ElementNo = parentIdx;
               ft->Elem1No = parentIdx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -143,20 +145,20 @@ namespace Rodin::Variational
             const auto& submesh = static_cast<const Geometry::SubMesh<Context::Serial>&>(fesMesh);
             assert(submesh.getParent() == simplexMesh);
             const auto& s2pe = submesh.getElementMap();
-            if (ft->Elem1 && s2pe.right.count(ft->Elem1No) &&
+            if (ft->Elem1 && s2pe.hasChild(ft->Elem1No) &&
                 this->getTraceDomain().count(ft->Elem1->Attribute))
             {
-              Geometry::Index idx = s2pe.right.at(ft->Elem1No);
+              Geometry::Index idx = s2pe.getChild(ft->Elem1No);
               ft->Elem1->ElementNo = idx;
               ft->Elem1No = idx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
               m_u.get().getHandle().GetGradient(*ft->Elem1, tmp);
               return grad;
             }
-            else if (ft->Elem2 && s2pe.right.count(ft->Elem2No) &&
+            else if (ft->Elem2 && s2pe.hasChild(ft->Elem2No) &&
                 this->getTraceDomain().count(ft->Elem2->Attribute))
             {
-              Geometry::Index idx = s2pe.right.at(ft->Elem2No);
+              Geometry::Index idx = s2pe.getChild(ft->Elem2No);
               ft->Elem2->ElementNo = idx;
               ft->Elem2No = idx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -166,7 +168,7 @@ namespace Rodin::Variational
             else if (face.isBoundary())
             {
               assert(ft->Elem1);
-              Geometry::Index idx = s2pe.right.at(ft->Elem1No);
+              Geometry::Index idx = s2pe.getChild(ft->Elem1No);
               ft->Elem1->ElementNo = idx;
               ft->Elem1No = idx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -298,7 +300,7 @@ namespace Rodin::Variational
           typename FormLanguage::Traits<ShapeFunctionBase<Operand, H1<Scalar, Ps...>, Space>>::RangeType;
         static_assert(std::is_same_v<OperandRange, Scalar>);
         const auto& fe = this->getFiniteElementSpace().getFiniteElement(p.getSimplex());
-        const Math::Vector& coords = p.getCoordinates(Geometry::Point::Coordinates::Reference);
+        const Math::Vector& coords = p.getReferenceCoordinates();
         return (fe.getGradient(coords) * p.getJacobianInverse()).transpose();
       }
 
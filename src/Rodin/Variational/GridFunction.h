@@ -420,13 +420,19 @@ namespace Rodin::Variational
       {
         if constexpr (std::is_same_v<RangeType, Scalar>)
         {
-          return Scalar(getHandle().GetValue(p.getTransformation().getHandle(), p.getIntegrationPoint()));
+          mfem::IsoparametricTransformation storage;
+          auto& trans = p.getTransformation().getHandle(storage);
+          trans.SetIntPoint(&p.getIntegrationPoint());
+          return Scalar(getHandle().GetValue(trans, p.getIntegrationPoint()));
         }
         else if constexpr (std::is_same_v<RangeType, Math::Vector>)
         {
           Math::Vector res(getFiniteElementSpace().getVectorDimension());
           mfem::Vector tmp(res.data(), res.size());
-          getHandle().GetVectorValue(p.getTransformation().getHandle(), p.getIntegrationPoint(), tmp);
+          mfem::IsoparametricTransformation storage;
+          auto& trans = p.getTransformation().getHandle(storage);
+          trans.SetIntPoint(&p.getIntegrationPoint());
+          getHandle().GetVectorValue(trans, p.getIntegrationPoint(), tmp);
           return res;
         }
         else
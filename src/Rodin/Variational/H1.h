@@ -113,7 +113,8 @@ namespace Rodin::Variational
         : m_fec(order, mesh.getDimension(), basis),
           m_mesh(mesh),
           m_fes(new mfem::FiniteElementSpace(
-                &mesh.getHandle(), &m_fec.getHandle(), vdim))
+                &mesh.getHandle(), &m_fec.getHandle(), vdim)),
+          m_dofs(mesh, *m_fes)
       {
         assert(order >= 1);
       }
@@ -122,14 +123,16 @@ namespace Rodin::Variational
         : FiniteElementSpaceBase(other),
           m_fec(other.m_fec),
           m_mesh(other.m_mesh),
-          m_fes(new mfem::FiniteElementSpace(*other.m_fes))
+          m_fes(new mfem::FiniteElementSpace(*other.m_fes)),
+          m_dofs(other.getMesh(), *m_fes)
       {}
 
       H1Base(H1Base&& other)
         : FiniteElementSpaceBase(std::move(other)),
           m_fec(std::move(other.m_fec)),
           m_mesh(std::move(other.m_mesh)),
-          m_fes(std::move(other.m_fes))
+          m_fes(std::move(other.m_fes)),
+          m_dofs(std::move(other.m_dofs))
       {}
 
       H1Base& operator=(H1Base&& other)
@@ -138,6 +141,7 @@ namespace Rodin::Variational
         m_fec = std::move(other.m_fec);
         m_mesh = std::move(other.m_mesh);
         m_fes = std::move(other.m_fes);
+        m_dofs = std::move(other.m_dofs);
         return *this;
       }
 
@@ -165,23 +169,25 @@ namespace Rodin::Variational
         return static_cast<const Derived&>(*this).getFiniteElement(element);
       }
 
+      /**
+       * @brief Determines if the space was built on the current topology of
+       * its mesh.
+       *
+       * The tables which the space caches are numbered after the simplices
+       * of the mesh, hence the space must be built again once the topology
+       * of the mesh changed.
+       */
       inline
-      mfem::Array<int> getDOFs(const Geometry::Simplex& element) const final override
+      bool isCurrent() const
       {
-        mfem::Array<int> res;
-        if (element.getDimension() == getMesh().getDimension())
-        {
-          m_fes->GetElementVDofs(element.getIndex(), res);
-        }
-        else if (element.getDimension() == getMesh().getDimension() - 1)
-        {
-          m_fes->GetFaceVDofs(element.getIndex(), res);
-        }
-        else
-        {
-          assert(false);
-        }
-        return res;
+        return m_dofs.isCurrent(getMesh());
+      }
+
+      inline
+      const mfem::Array<int>& getDOFs(const Geometry::Simplex& element) const final override
+      {
+        assert(isCurrent());
+        return m_dofs.get(element.getDimension(), element.getIndex());
       }
 
       mfem::FiniteElementSpace& getHandle() const final override
@@ -194,6 +200,7 @@ namespace Rodin::Variational
       FEC m_fec;
       std::reference_wrapper<const Geometry::Mesh<Context>> m_mesh;
       std::unique_ptr<mfem::FiniteElementSpace> m_fes;
+      Internal::DOFTable m_dofs;
   };
 
   template <class ContextType>
@@ -283,15 +290,22 @@ namespace Rodin::Variational
 
       H1(const H1& other)
         : Parent(other)
-      {}
+      {
+        const auto& mesh = this->getMesh();
+        m_fe.resize(mesh.getDimension() + 1);
+        for (size_t i = 0; i < mesh.getDimension() + 1; i++)
+          m_fe[i].resize(mesh.getSimplexCount(i));
+      }
 
       H1(H1&& other)
-        : Parent(std::move(other))
+        : Parent(std::move(other)),
+          m_fe(std::move(other.m_fe))
       {}
 
       H1& operator=(H1&& other)
       {
         Parent::operator=(std::move(other));
+        m_fe = std::move(other.m_fe);
         return *this;
       }
 
@@ -299,6 +313,8 @@ namespace Rodin::Variational
       const FiniteElement<H1<Math::Vector, Context>>&
       getFiniteElement(const Geometry::Simplex& simplex) const
       {
+        // The elements are cached per simplex of the mesh on construction
+        assert(this->isCurrent());
         assert(m_fe.size() > simplex.getDimension());
         assert(m_fe[simplex.getDimension()].size() > simplex.getIndex());
         auto& fe = m_fe[simplex.getDimension()][simplex.getIndex()];
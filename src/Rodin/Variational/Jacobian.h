@@ -77,8 +77,10 @@ namespace Rodin::Variational
         mfem::DenseMatrix tmp(jacobian.data(), jacobian.rows(), jacobian.cols());
         if (simplex.getDimension() == fesMesh.getDimension())
         {
-          const auto& trans = p.getTransformation();
-          m_u.get().getHandle().GetVectorGradient(trans.getHandle(), tmp);
+          mfem::IsoparametricTransformation storage;
+          auto& trans = p.getTransformation().getHandle(storage);
+          trans.SetIntPoint(&p.getIntegrationPoint());
+          m_u.get().getHandle().GetVectorGradient(trans, tmp);
           return jacobian;
         }
         else if (simplex.getDimension() == fesMesh.getDimension() - 1)
@@ -93,7 +95,7 @@ namespace Rodin::Variational
             assert(submesh.getParent() == fesMesh);
             if (ft->Elem1 && this->getTraceDomain().count(ft->Elem1->Attribute))
             {
-              Geometry::Index parentIdx = submesh.getElementMap().left.at(ft->Elem1No);
+              Geometry::Index parentIdx = submesh.getElementMap().getParent(ft->Elem1No);
               ft->Elem1->ElementNo = parentIdx;
               ft->Elem1No = parentIdx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -102,7 +104,7 @@ namespace Rodin::Variational
             }
             else if (ft->Elem2 && this->getTraceDomain().count(ft->Elem2->Attribute))
             {
-              Geometry::Index parentIdx = submesh.getElementMap().left.at(ft->Elem2No);
+              Geometry::Index parentIdx = submesh.getElementMap().getParent(ft->Elem2No);
               ft->Elem2->ElementNo = parentIdx;
               ft->Elem2No = parentIdx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -112,7 +114,7 @@ namespace Rodin::Variational
             else if (face.isBoundary())
             {
               assert(ft->Elem1);
-              Geometry::Index parentIdx = submesh.getElementMap().left.at(ft->Elem1No);
+              Geometry::Index parentIdx = submesh.getElementMap().getParent(ft->Elem1No);
               ft->Elem1->ElementNo = parentIdx;
               ft->Elem1No = parentIdx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -131,20 +133,20 @@ namespace Rodin::Variational
             const auto& submesh = static_cast<const Geometry::SubMesh<Context::Serial>&>(fesMesh);
             assert(submesh.getParent() == simplexMesh);
             const auto& s2pe = submesh.getElementMap();
-            if (ft->Elem1 && s2pe.right.count(ft->Elem1No) &&
+            if (ft->Elem1 && s2pe.hasChild(ft->Elem1No) &&
                 this->getTraceDomain().count(ft->Elem1->Attribute))
             {
-              Geometry::Index idx = s2pe.right.at(ft->Elem1No);
+              Geometry::Index idx = s2pe.getChild(ft->Elem1No);
               ft->Elem1->ElementNo = idx;
               ft->Elem1No = idx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
               m_u.get().getHandle().GetVectorGradient(*ft->Elem1, tmp);
               return jacobian;
             }
-            else if (ft->Elem2 && s2pe.right.count(ft->Elem2No) &&
+            else if (ft->Elem2 && s2pe.hasChild(ft->Elem2No) &&
                 this->getTraceDomain().count(ft->Elem2->Attribute))
             {
-              Geometry::Index idx = s2pe.right.at(ft->Elem2No);
+              Geometry::Index idx = s2pe.getChild(ft->Elem2No);
               ft->Elem2->ElementNo = idx;
               ft->Elem2No = idx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -154,7 +156,7 @@ namespace Rodin::Variational
             else if (face.isBoundary())
             {
               assert(ft->Elem1);
-              Geometry::Index idx = s2pe.right.at(ft->Elem1No);
+              Geometry::Index idx = s2pe.getChild(ft->Elem1No);
               ft->Elem1->ElementNo = idx;
               ft->Elem1No = idx;
               ft->SetAllIntPoints(&p.getIntegrationPoint());
@@ -312,7 +314,7 @@ namespace Rodin::Variational
         const auto& inv = p.getJacobianInverse();
         const Eigen::TensorMap<const Eigen::Tensor<Scalar, 2>> lift(inv.data(), inv.rows(), inv.cols());
         static constexpr const Eigen::array<Eigen::IndexPair<int>, 1> dims = { Eigen::IndexPair<int>(2, 0) };
-        const Math::Vector& coords = p.getCoordinates(Geometry::Point::Coordinates::Reference);
+        const Math::Vector& coords = p.getReferenceCoordinates();
         return fe.getJacobian(coords).contract(lift, dims)
                                      .shuffle(Eigen::array<int, 3>{2, 1, 0});
       }
@@ -153,21 +153,24 @@ namespace Rodin::Variational
           const size_t vdim, const size_t order, Basis basis = DefaultBasis)
         : m_fec(order, mesh.getDimension(), basis),
           m_mesh(mesh),
-          m_fes(new mfem::FiniteElementSpace(&mesh.getHandle(), &m_fec.getHandle(), vdim))
+          m_fes(new mfem::FiniteElementSpace(&mesh.getHandle(), &m_fec.getHandle(), vdim)),
+          m_dofs(mesh, *m_fes)
       {}
 
       L2Base(const L2Base& other)
         : FiniteElementSpaceBase(other),
           m_fec(other.m_fec),
           m_mesh(other.m_mesh),
-          m_fes(new mfem::FiniteElementSpace(*other.m_fes))
+          m_fes(new mfem::FiniteElementSpace(*other.m_fes)),
+          m_dofs(other.getMesh(), *m_fes)
       {}
 
       L2Base(L2Base&& other)
         :  FiniteElementSpaceBase(std::move(other)),
           m_fec(std::move(other.m_fec)),
           m_mesh(std::move(other.m_mesh)),
-          m_fes(std::move(other.m_fes))
+          m_fes(std::move(other.m_fes)),
+          m_dofs(std::move(other.m_dofs))
       {}
 
       L2Base& operator=(L2Base&& other)
@@ -176,6 +179,7 @@ namespace Rodin::Variational
         m_fec = std::move(other.m_fec);
         m_mesh = std::move(other.m_mesh);
         m_fes = std::move(other.m_fes);
+        m_dofs = std::move(other.m_dofs);
         return *this;
       }
 
@@ -222,23 +226,25 @@ namespace Rodin::Variational
         }
       }
 
+      /**
+       * @brief Determines if the space was built on the current topology of
+       * its mesh.
+       *
+       * The tables which the space caches are numbered after the simplices
+       * of the mesh, hence the space must be built again once the topology
+       * of the mesh changed.
+       */
       inline
-      mfem::Array<int> getDOFs(const Geometry::Simplex& element) const final override
+      bool isCurrent() const
       {
-        mfem::Array<int> res;
-        if (element.getDimension() == getMesh().getDimension())
-        {
-          m_fes->GetElementVDofs(element.getIndex(), res);
-        }
-        else if (element.getDimension() == getMesh().getDimension() - 1)
-        {
-          m_fes->GetFaceVDofs(element.getIndex(), res);
-        }
-        else
-        {
-          assert(false);
-        }
-        return res;
+        return m_dofs.isCurrent(getMesh());
+      }
+
+      inline
+      const mfem::Array<int>& getDOFs(const Geometry::Simplex& element) const final override
+      {
+        assert(isCurrent());
+        return m_dofs.get(element.getDimension(), element.getIndex());
       }
 
       mfem::FiniteElementSpace& getHandle() const final override
@@ -251,6 +257,7 @@ namespace Rodin::Variational
       FEC m_fec;
       std::reference_wrapper<Geometry::Mesh<Context>> m_mesh;
       std::unique_ptr<mfem::FiniteElementSpace> m_fes;
+      Internal::DOFTable m_dofs;
   };
 
   template <class ContextType>
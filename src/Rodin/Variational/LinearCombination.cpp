@@ -0,0 +1,108 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cassert>
+#include <algorithm>
+
+#include "LinearCombination.h"
+
+namespace Rodin::Variational
+{
+  LinearCombination::LinearCombination(std::vector<Operand> operands)
+    : m_operands(std::move(operands)),
+      m_coefficients(m_operands.size(), 1.0),
+      m_positions(m_operands.size())
+  {
+    assert(m_operands.size() > 0);
+    const int height = m_operands.front().get().Height();
+    const int width = m_operands.front().get().Width();
+    for (const auto& op : m_operands)
+    {
+      assert(op.get().Finalized());
+      assert(op.get().Height() == height);
+      assert(op.get().Width() == width);
+    }
+
+    // Union of the column indices of each row
+    int* rows = new int[height + 1];
+    std::vector<int> columns;
+    std::vector<int> row;
+    rows[0] = 0;
+    for (int i = 0; i < height; i++)
+    {
+      row.clear();
+      for (const auto& op : m_operands)
+      {
+        const int* opRows = op.get().GetI();
+        const int* opColumns = op.get().GetJ();
+        row.insert(row.end(), opColumns + opRows[i], opColumns + opRows[i + 1]);
+      }
+      std::sort(row.begin(), row.end());
+      row.erase(std::unique(row.begin(), row.end()), row.end());
+      columns.insert(columns.end(), row.begin(), row.end());
+      rows[i + 1] = columns.size();
+    }
+
+    // Position of each entry of each operand in the common pattern
+    for (size_t k = 0; k < m_operands.size(); k++)
+    {
+      const auto& op = m_operands[k].get();
+      const int* opRows = op.GetI();
+      const int* opColumns = op.GetJ();
+      auto& positions = m_positions[k];
+      positions.resize(op.NumNonZeroElems());
+      for (int i = 0; i < height; i++)
+      {
+        const auto begin = columns.begin() + rows[i];
+        const auto end = columns.begin() + rows[i + 1];
+        for (int p = opRows[i]; p < opRows[i + 1]; p++)
+        {
+          const auto it = std::lower_bound(begin, end, opColumns[p]);
+          assert(it != end && *it == opColumns[p]);
+          positions[p] = it - columns.begin();
+        }
+      }
+    }
+
+    int* j = new int[columns.size()];
+    std::copy(columns.begin(), columns.end(), j);
+    double* data = new double[columns.size()];
+    mfem::SparseMatrix res(rows, j, data, height, width);
+    m_operator.Swap(res);
+
+    update();
+  }
+
+  LinearCombination& LinearCombination::setCoefficients(const std::vector<Scalar>& coefficients)
+  {
+    assert(coefficients.size() == m_operands.size());
+    if (coefficients != m_coefficients)
+    {
+      m_coefficients = coefficients;
+      update();
+    }
+    return *this;
+  }
+
+  LinearCombination& LinearCombination::update()
+  {
+    double* data = m_operator.GetData();
+    std::fill(data, data + m_operator.NumNonZeroElems(), 0.0);
+    for (size_t k = 0; k < m_operands.size(); k++)
+    {
+      const auto& op = m_operands[k].get();
+      const auto& positions = m_positions[k];
+      assert(static_cast<size_t>(op.NumNonZeroElems()) == positions.size());
+      const Scalar c = m_coefficients[k];
+      if (c == 0.0)
+        continue;
+      const double* values = op.GetData();
+      for (size_t p = 0; p < positions.size(); p++)
+        data[positions[p]] += c * values[p];
+    }
+    return *this;
+  }
+}
@@ -0,0 +1,129 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_VARIATIONAL_LINEARCOMBINATION_H
+#define RODIN_VARIATIONAL_LINEARCOMBINATION_H
+
+#include <vector>
+#include <functional>
+#include <initializer_list>
+
+#include <mfem.hpp>
+
+#include "Rodin/Types.h"
+
+namespace Rodin::Variational
+{
+  /**
+   * @brief Linear combination of assembled sparse matrices.
+   *
+   * Represents the matrix
+   * @f[
+   *   A = \sum_{i} c_i A_i
+   * @f]
+   * where the operands @f$ A_i @f$ are finalized sparse matrices of the same
+   * size. The sparsity pattern of @f$ A @f$ is the union of the patterns of
+   * the operands and it is computed only once, at construction, together
+   * with the position of each nonzero entry of each operand inside it.
+   * Changing the coefficients then only recomputes the values of @f$ A @f$
+   * in a single pass over the nonzero entries, without any reassembly or
+   * allocation. This is the typical situation of time stepping schemes,
+   * where @f$ M + \Delta t \ K @f$ is required for several time steps
+   * @f$ \Delta t @f$, or of regularized problems, where
+   * @f$ A + \alpha R @f$ is solved for several values of @f$ \alpha @f$.
+   *
+   * The operands are held by reference and must outlive the object. If
+   * their values change but not their pattern, the combination may be
+   * recomputed by calling update().
+   *
+   * @code{.cpp}
+   * LinearCombination a({ mass.getOperator(), stiffness.getOperator() });
+   * for (Scalar dt : { 0.1, 0.05, 0.01 })
+   * {
+   *   a.setCoefficients({ 1.0, dt });
+   *   solver.solve(a.getOperator(), x, b);
+   * }
+   * @endcode
+   */
+  class LinearCombination
+  {
+    public:
+      using Operand = std::reference_wrapper<const mfem::SparseMatrix>;
+
+      /**
+       * @brief Builds the common sparsity pattern of the given operands.
+       *
+       * The coefficients are initialized to one.
+       */
+      LinearCombination(std::initializer_list<Operand> operands)
+        : LinearCombination(std::vector<Operand>(operands))
+      {}
+
+      /**
+       * @brief Builds the common sparsity pattern of the given operands.
+       *
+       * The coefficients are initialized to one.
+       */
+      LinearCombination(std::vector<Operand> operands);
+
+      LinearCombination(const LinearCombination&) = delete;
+
+      LinearCombination& operator=(const LinearCombination&) = delete;
+
+      /**
+       * @brief Sets the coefficients of the combination.
+       *
+       * The values of the operator are only recomputed if the coefficients
+       * differ from the current ones.
+       *
+       * @param[in] coefficients Coefficients @f$ c_i @f$, one per operand.
+       */
+      LinearCombination& setCoefficients(const std::vector<Scalar>& coefficients);
+
+      const std::vector<Scalar>& getCoefficients() const
+      {
+        return m_coefficients;
+      }
+
+      /**
+       * @brief Recomputes the values of the operator.
+       *
+       * Must be called if the values of the operands changed after
+       * construction. The sparsity patterns of the operands must not have
+       * changed.
+       */
+      LinearCombination& update();
+
+      /**
+       * @brief Gets the number of operands.
+       */
+      size_t getSize() const
+      {
+        return m_operands.size();
+      }
+
+      mfem::SparseMatrix& getOperator()
+      {
+        return m_operator;
+      }
+
+      const mfem::SparseMatrix& getOperator() const
+      {
+        return m_operator;
+      }
+
+    private:
+      std::vector<Operand> m_operands;
+      std::vector<Scalar> m_coefficients;
+
+      /// Position in the common pattern of each nonzero entry of each operand.
+      std::vector<std::vector<int>> m_positions;
+
+      mfem::SparseMatrix m_operator;
+  };
+}
+
+#endif
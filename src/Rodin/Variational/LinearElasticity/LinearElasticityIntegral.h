@@ -3,11 +3,13 @@
 
 #include "Rodin/Variational/MFEM.h"
 #include "Rodin/Variational/Function.h"
+#include "Rodin/Variational/QuadratureRule.h"
+#include "Rodin/Variational/ElementKernels.h"
 #include "Rodin/Variational/BilinearFormIntegrator.h"
 
 namespace Rodin::Variational
 {
-  template <class TrialFES, class TestFES, class MuDerived, class LambdaDerived>
+  template <class TrialFES, class TestFES, class LambdaDerived, class MuDerived>
   class LinearElasticityIntegrator final : public BilinearFormIntegratorBase
   {
     public:
@@ -37,12 +39,24 @@ namespace Rodin::Variational
 
       LinearElasticityIntegrator(LinearElasticityIntegrator&& other)
         : Parent(std::move(other)),
-          m_lambda(std::move(other.m_lambda)), m_mu(std::move(other.mu)),
+          m_lambda(std::move(other.m_lambda)), m_mu(std::move(other.m_mu)),
           m_fes(std::move(other.m_fes))
       {}
 
       Math::Matrix getMatrix(const Geometry::Simplex& simplex) const override
       {
+        const auto& fes = getFiniteElementSpace();
+        const auto lambdaValue = Internal::ElementKernels::getConstant(getLambda());
+        const auto muValue = Internal::ElementKernels::getConstant(getMu());
+        const auto& order = getQuadratureOrder();
+        if (!order && lambdaValue && muValue
+            && fes.getVectorDimension() == simplex.getMesh().getSpaceDimension()
+            && Internal::ElementKernels::isSupported(simplex, fes))
+        {
+          return Internal::ElementKernels::getElasticityMatrix(
+              fes.getOrder(simplex), Internal::ElementKernels::getAffineSimplex(simplex),
+              *lambdaValue, *muValue);
+        }
         const auto& fe = getFiniteElementSpace().getFiniteElement(simplex);
         const auto& trans = simplex.getTransformation();
         Math::Matrix res(fe.getDOFs(), fe.getDOFs());
@@ -50,10 +64,27 @@ namespace Rodin::Variational
         Internal::MFEMScalarCoefficient mu(simplex.getMesh(), getMu());
         Internal::MFEMScalarCoefficient lambda(simplex.getMesh(), getLambda());
         mfem::ElasticityIntegrator bfi(lambda, mu);
-        bfi.AssembleElementMatrix(fe.getHandle(), trans.getHandle(), tmp);
+        if (order)
+          bfi.SetIntRule(&QuadratureRule::get(simplex.getGeometry(), *order).getHandle());
+        mfem::IsoparametricTransformation storage;
+        bfi.AssembleElementMatrix(fe.getHandle(), trans.getHandle(storage), tmp);
         return res;
       }
 
+      std::optional<StandardForm> getStandardForm() const override
+      {
+        const auto lambda = Internal::ElementKernels::getConstant(getLambda());
+        const auto mu = Internal::ElementKernels::getConstant(getMu());
+        if (lambda && mu)
+          return StandardForm{ StandardForm::Type::Elasticity, 1.0, *lambda, *mu };
+        return std::nullopt;
+      }
+
+      bool isSymmetric() const override
+      {
+        return true;
+      }
+
       inline
       constexpr
       const Mu& getMu() const
@@ -22,6 +22,7 @@ namespace Rodin::Variational
   {
     public:
       using NativeAssembly = Assembly::Native<LinearFormBase>;
+      using OpenMPAssembly = Assembly::OpenMP<LinearFormBase>;
 
       LinearFormBase()
       {
@@ -8,6 +8,7 @@
 #define RODIN_VARIATIONAL_LINEARFORMINTEGRATOR_H
 
 #include <set>
+#include <optional>
 
 #include "Rodin/Math/Vector.h"
 
@@ -33,13 +34,15 @@ namespace Rodin::Variational
       LinearFormIntegratorBase(const LinearFormIntegratorBase& other)
         : Parent(other),
           m_v(other.m_v),
-          m_attrs(other.m_attrs)
+          m_attrs(other.m_attrs),
+          m_order(other.m_order)
       {}
 
       LinearFormIntegratorBase(LinearFormIntegratorBase&& other)
         : Parent(std::move(other)),
           m_v(std::move(other.m_v)),
-          m_attrs(std::move(other.m_attrs))
+          m_attrs(std::move(other.m_attrs)),
+          m_order(std::move(other.m_order))
       {}
 
       virtual ~LinearFormIntegratorBase() = default;
@@ -87,6 +90,32 @@ namespace Rodin::Variational
         return *this;
       }
 
+      /**
+       * @brief Sets the order of the quadrature rule used to integrate over
+       * each element.
+       * @returns Reference to self (for method chaining)
+       *
+       * By default the order is the sum of the orders of the finite
+       * elements and of the geometric transformation. A lower order uses fewer quadrature
+       * points, at the expense of accuracy. Integrators which compute the
+       * element vectors in closed form only do so if the order is not set.
+       */
+      inline
+      LinearFormIntegratorBase& setQuadratureOrder(size_t order)
+      {
+        m_order = order;
+        return *this;
+      }
+
+      /**
+       * @brief Gets the order of the quadrature rule, if it was set.
+       */
+      inline
+      const std::optional<size_t>& getQuadratureOrder() const
+      {
+        return m_order;
+      }
+
       inline
       Integrator::Type getType() const
       final override
@@ -107,6 +136,7 @@ namespace Rodin::Variational
     private:
       std::reference_wrapper<const FormLanguage::Base> m_v;
       std::set<Geometry::Attribute> m_attrs;
+      std::optional<size_t> m_order;
   };
 }
 
@@ -241,6 +241,146 @@ namespace Rodin::Variational
 
       std::unique_ptr<mfem::BilinearForm> m_tmp;
   };
+
+  /**
+   * @ingroup ProblemSpecializations
+   * @brief General class to assemble linear systems with `mfem::Operator`
+   * and `mfem::Vector` types in a serial context.
+   *
+   * The stiffness operator is only known through its action, hence it is
+   * suited to iterative solvers such as Solver::CG. The essential boundary
+   * conditions are imposed by wrapping the operator in an
+   * `mfem::ConstrainedOperator`.
+   */
+  template <class TrialFES, class TestFES>
+  class Problem<TrialFES, TestFES, Context::Serial, mfem::Operator, mfem::Vector>
+    : public ProblemBase<mfem::Operator, mfem::Vector>
+  {
+      static_assert(std::is_same_v<typename TrialFES::Context, Context::Serial>);
+      static_assert(std::is_same_v<typename TestFES::Context, Context::Serial>);
+
+    public:
+      using Context = Context::Serial;
+      using OperatorType = mfem::Operator;
+      using VectorType = mfem::Vector;
+      using Parent = ProblemBase<mfem::Operator, mfem::Vector>;
+
+      /**
+       * @brief Constructs an empty problem involving the trial function @f$ u @f$
+       * and the test function @f$ v @f$.
+       *
+       * @param[in,out] u Trial function
+       * @param[in,out] v %Test function
+       */
+      explicit
+      constexpr
+      Problem(TrialFunction<TrialFES>& u, TestFunction<TestFES>& v);
+
+      /**
+       * @brief Deleted copy constructor.
+       */
+      Problem(const Problem& other) = delete;
+
+      /**
+       * @brief Deleted copy assignment operator.
+       */
+      void operator=(const Problem& other) = delete;
+
+      constexpr
+      TrialFunction<TrialFES>& getTrialFunction()
+      {
+        return m_trialFunction;
+      }
+
+      constexpr
+      TestFunction<TestFES>& getTestFunction()
+      {
+        return m_testFunction;
+      }
+
+      constexpr
+      const TrialFunction<TrialFES>& getTrialFunction() const
+      {
+        return m_trialFunction;
+      }
+
+      constexpr
+      const TestFunction<TestFES>& getTestFunction() const
+      {
+        return m_testFunction;
+      }
+
+      constexpr
+      LinearForm<TestFES, Context, VectorType>& getLinearForm()
+      {
+        return m_linearForm;
+      }
+
+      constexpr
+      BilinearForm<TrialFES, TestFES, Context, OperatorType>& getBilinearForm()
+      {
+        return m_bilinearForm;
+      }
+
+      constexpr
+      const LinearForm<TestFES, Context, VectorType>& getLinearForm() const
+      {
+        return m_linearForm;
+      }
+
+      constexpr
+      const BilinearForm<TrialFES, TestFES, Context, OperatorType>& getBilinearForm() const
+      {
+        return m_bilinearForm;
+      }
+
+      void assemble() override;
+
+      void solve(const Solver::SolverBase<OperatorType, VectorType>& solver) override;
+
+      Problem& operator=(ProblemBody&& rhs) override;
+
+      virtual VectorType& getMassVector() override
+      {
+        return m_massVector;
+      }
+
+      virtual const VectorType& getMassVector() const override
+      {
+        return m_massVector;
+      }
+
+      virtual OperatorType& getStiffnessOperator() override
+      {
+        assert(m_stiffnessOp);
+        return *m_stiffnessOp;
+      }
+
+      virtual const OperatorType& getStiffnessOperator() const override
+      {
+        assert(m_stiffnessOp);
+        return *m_stiffnessOp;
+      }
+
+      virtual Problem* copy() const noexcept override
+      {
+        assert(false);
+        return nullptr;
+      }
+
+    private:
+      TrialFunction<TrialFES>& m_trialFunction;
+      TestFunction<TestFES>&  m_testFunction;
+
+      LinearForm<TestFES, Context, VectorType> m_linearForm;
+      BilinearForm<TrialFES, TestFES, Context, OperatorType> m_bilinearForm;
+
+      std::unique_ptr<mfem::ConstrainedOperator> m_stiffnessOp;
+      mfem::Vector    m_massVector;
+      mfem::Vector    m_guess;
+
+      mfem::Array<int> m_trialEssTrueDofList;
+  };
 }
 
 #include "Problem.hpp"
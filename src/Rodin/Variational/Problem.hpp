@@ -11,6 +11,11 @@
 
 #include "Rodin/Utility.h"
 #include "Assembly/Native.h"
+#include "Assembly/MatrixFree.h"
+#include "Assembly/Partial.h"
+#include "Assembly/Symmetric.h"
+#include "Assembly/Block.h"
+#include "Assembly/OpenMP.h"
 
 #include "GridFunction.h"
 #include "DirichletBC.h"
@@ -54,9 +59,13 @@ namespace Rodin::Variational
    void
    Problem<TrialFES, TestFES, Context::Serial, mfem::SparseMatrix, mfem::Vector>::assemble()
    {
-      // Assemble both sides
+      // Assemble both sides, only updating the stale contributions of an
+      // incremental bilinear form
       getLinearForm().assemble();
-      getBilinearForm().assemble();
+      if (getBilinearForm().isIncremental())
+         getBilinearForm().reassemble();
+      else
+         getBilinearForm().assemble();
 
       // Emplace data
       getTrialFunction().emplace();
@@ -79,8 +88,17 @@ namespace Rodin::Variational
       {
          assert(&trialFes == &testFes);
 
-         // Form linear system
-         m_stiffnessOp.Swap(getBilinearForm().getOperator());
+         // Form linear system. The matrix of an incremental bilinear form is
+         // kept intact for the next reassembly.
+         if (getBilinearForm().isIncremental())
+         {
+            mfem::SparseMatrix stiffnessOp(getBilinearForm().getOperator());
+            m_stiffnessOp.Swap(stiffnessOp);
+         }
+         else
+         {
+            m_stiffnessOp.Swap(getBilinearForm().getOperator());
+         }
          m_tmp.reset(new mfem::BilinearForm(&trialFes.getHandle()));
          m_tmp->Assemble();
          m_tmp->SpMat().Swap(m_stiffnessOp);
@@ -114,6 +132,94 @@ namespace Rodin::Variational
             getLinearForm().getVector(),
             getTrialFunction().getSolution().getHandle());
    }
+
+   // ------------------------------------------------------------------------
+   // ---- Problem<TrialFES, TestFES, Context::Serial, mfem::Operator, mfem::Vector>
+   // ------------------------------------------------------------------------
+
+   template <class TrialFES, class TestFES>
+   constexpr
+   Problem<TrialFES, TestFES, Context::Serial, mfem::Operator, mfem::Vector>
+   ::Problem(TrialFunction<TrialFES>& u, TestFunction<TestFES>& v)
+      :  m_trialFunction(u),
+         m_testFunction(v),
+         m_linearForm(v),
+         m_bilinearForm(u, v)
+   {}
+
+   template <class TrialFES, class TestFES>
+   Problem<TrialFES, TestFES, Context::Serial, mfem::Operator, mfem::Vector>&
+   Problem<TrialFES, TestFES, Context::Serial, mfem::Operator, mfem::Vector>
+   ::operator=(ProblemBody&& rhs)
+   {
+      Parent::operator=(std::move(rhs));
+
+      for (auto& bfi : getProblemBody().getBFIs())
+         getBilinearForm().add(bfi);
+
+      for (auto& lfi : getProblemBody().getLFIs())
+         getLinearForm().add(UnaryMinus(lfi)); // Negate every linear form
+
+      return *this;
+   }
+
+   template <class TrialFES, class TestFES>
+   void
+   Problem<TrialFES, TestFES, Context::Serial, mfem::Operator, mfem::Vector>::assemble()
+   {
+      // Assemble both sides
+      getLinearForm().assemble();
+      getBilinearForm().assemble();
+
+      // Emplace data
+      getTrialFunction().emplace();
+      getTestFunction().emplace();
+
+      // Project values onto the essential boundary and compute essential dofs
+      m_trialEssTrueDofList.DeleteAll();
+      for (const auto& dbc : getProblemBody().getDBCs())
+      {
+         dbc.project();
+         m_trialEssTrueDofList.Append(dbc.getDOFs());
+      }
+
+      m_trialEssTrueDofList.Sort();
+      m_trialEssTrueDofList.Unique();
+
+      if constexpr (std::is_same_v<TrialFES, TestFES>)
+      {
+         assert(&getTrialFunction().getFiniteElementSpace()
+               == &getTestFunction().getFiniteElementSpace());
+
+         // Form linear system, the essential values are eliminated from the
+         // right hand side and imposed by the constrained operator.
+         m_stiffnessOp.reset(
+               new mfem::ConstrainedOperator(
+                  &getBilinearForm().getOperator(), m_trialEssTrueDofList));
+         m_guess = getTrialFunction().getSolution().getHandle();
+         m_massVector = getLinearForm().getVector();
+         m_stiffnessOp->EliminateRHS(m_guess, m_massVector);
+      }
+      else
+      {
+         assert(false); // Not supported yet
+      }
+   }
+
+   template <class TrialFES, class TestFES>
+   void
+   Problem<TrialFES, TestFES, Context::Serial, mfem::Operator, mfem::Vector>
+   ::solve(const Solver::SolverBase<OperatorType, VectorType>& solver)
+   {
+      // Assemble the system
+      assemble();
+
+      // Solve the system Ax = b
+      solver.solve(getStiffnessOperator(), m_guess, getMassVector());
+
+      // Recover solution
+      getTrialFunction().getSolution().getHandle() = m_guess;
+   }
 }
 
 #endif
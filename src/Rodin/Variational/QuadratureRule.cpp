@@ -1,6 +1,88 @@
+#include <array>
+
 #include "QuadratureRule.h"
 
 namespace Rodin::Variational
 {
   std::map<QuadratureRule::Key, QuadratureRule> QuadratureRule::s_rules = {};
+
+  std::mutex QuadratureRule::s_mutex;
+
+  const QuadratureRule& QuadratureRule::get(Geometry::Type geometry, size_t order)
+  {
+    using Table =
+      std::array<std::vector<QuadratureRule>, static_cast<size_t>(Geometry::Type::Pyramid) + 1>;
+    static const Table s_table =
+      []()
+      {
+        Table res;
+        for (const auto g : {
+            Geometry::Type::Point, Geometry::Type::Segment,
+            Geometry::Type::Triangle, Geometry::Type::Square,
+            Geometry::Type::Tetrahedron, Geometry::Type::Cube,
+            Geometry::Type::Prism })
+        {
+          auto& rules = res[static_cast<size_t>(g)];
+          rules.reserve(MaximalOrder + 1);
+          for (size_t k = 0; k <= MaximalOrder; k++)
+            rules.emplace_back(mfem::IntRules.Get(static_cast<int>(g), k), getDimension(g));
+        }
+        return res;
+      }();
+
+    const auto& rules = s_table[static_cast<size_t>(geometry)];
+    if (order < rules.size())
+      return rules[order];
+
+    Key key{geometry, order};
+    std::lock_guard<std::mutex> lock(s_mutex);
+    auto search = s_rules.lower_bound(key);
+    if (search != s_rules.end() && !(s_rules.key_comp()(key, search->first)))
+    {
+      // key already exists
+      return search->second;
+    }
+    else
+    {
+      const mfem::IntegrationRule& ir = mfem::IntRules.Get(static_cast<int>(geometry), order);
+      auto it = s_rules.insert(search, {key, QuadratureRule(ir, getDimension(geometry))});
+      return it->second;
+    }
+  }
+
+  QuadratureRule::QuadratureRule(const mfem::IntegrationRule& ir, size_t dim)
+    : m_handle(&ir), m_weights(ir.GetNPoints()), m_points(dim, ir.GetNPoints())
+  {
+    m_coordinates.reserve(ir.GetNPoints());
+    for (int i = 0; i < ir.GetNPoints(); i++)
+    {
+      const mfem::IntegrationPoint& ip = ir.IntPoint(i);
+      const Scalar coords[3] = { ip.x, ip.y, ip.z };
+      m_weights.coeffRef(i) = ip.weight;
+      for (size_t k = 0; k < dim; k++)
+        m_points.coeffRef(k, i) = coords[k];
+      m_coordinates.emplace_back(m_points.col(i));
+    }
+  }
+
+  size_t QuadratureRule::getDimension(Geometry::Type geometry)
+  {
+    switch (geometry)
+    {
+      case Geometry::Type::Point:
+        return 0;
+      case Geometry::Type::Segment:
+        return 1;
+      case Geometry::Type::Square:
+      case Geometry::Type::Triangle:
+        return 2;
+      case Geometry::Type::Cube:
+      case Geometry::Type::Prism:
+      case Geometry::Type::Pyramid:
+      case Geometry::Type::Tetrahedron:
+        return 3;
+    }
+    assert(false);
+    return 0;
+  }
 }
@@ -1,6 +1,8 @@
 #ifndef RODIN_VARIATIONAL_QUADRATURERULE_H
 #define RODIN_VARIATIONAL_QUADRATURERULE_H
 
+#include <map>
+#include <mutex>
 #include <vector>
 #include <utility>
 
@@ -11,73 +13,28 @@
 
 namespace Rodin::Variational
 {
+  /**
+   * @brief Quadrature rule on a reference geometry.
+   *
+   * The weights and the reference coordinates of the points are stored in
+   * structure of arrays form. The rules of all the geometries, except
+   * pyramids, are built once up to the order
+   * RODIN_MAXIMAL_QUADRATURE_ORDER on the first call to get(), after which
+   * they are accessed by index without any synchronization. Rules of higher
+   * order are built on demand.
+   */
   class QuadratureRule
   {
     using Key = std::pair<Geometry::Type, size_t>;
     static std::map<Key, QuadratureRule> s_rules;
-
-    struct ValueType
-    {
-      Scalar weight;
-      Math::Vector point;
-    };
+    static std::mutex s_mutex;
 
     public:
+      static constexpr const size_t MaximalOrder = RODIN_MAXIMAL_QUADRATURE_ORDER;
 
-      static const QuadratureRule& get(Geometry::Type geometry, size_t order)
-      {
-        Key key{geometry, order};
-        auto search = s_rules.lower_bound(key);
-        if (search != s_rules.end() && !(s_rules.key_comp()(key, search->first)))
-        {
-          // key already exists
-          return search->second;
-        }
-        else
-        {
-          size_t dim;
-          switch (geometry)
-          {
-            case Geometry::Type::Point:
-            {
-              dim = 0;
-              break;
-            }
-            case Geometry::Type::Segment:
-            {
-              dim = 1;
-              break;
-            }
-            case Geometry::Type::Square:
-            case Geometry::Type::Triangle:
-            {
-              dim = 2;
-              break;
-            }
-            case Geometry::Type::Cube:
-            case Geometry::Type::Prism:
-            case Geometry::Type::Pyramid:
-            case Geometry::Type::Tetrahedron:
-            {
-              dim = 3;
-              break;
-            }
-          }
-          const mfem::IntegrationRule& ir = mfem::IntRules.Get(static_cast<int>(geometry), order);
-          auto it = s_rules.insert(search, {key, QuadratureRule(ir, dim)});
-          return it->second;
-        }
-      }
+      static const QuadratureRule& get(Geometry::Type geometry, size_t order);
 
-      QuadratureRule(const mfem::IntegrationRule& ir, size_t dim)
-      {
-        m_points.reserve(ir.GetNPoints());
-        for (int i = 0; i < ir.GetNPoints(); i++)
-        {
-          const mfem::IntegrationPoint& ip = ir.IntPoint(i);
-          m_points.push_back(ValueType{ip.weight, Internal::ip2vec(ip, dim)});
-        }
-      }
+      QuadratureRule(const mfem::IntegrationRule& ir, size_t dim);
 
       QuadratureRule(const QuadratureRule&) = default;
 
@@ -86,27 +43,60 @@ namespace Rodin::Variational
       inline
       size_t size() const
       {
-        return m_points.size();
+        return m_weights.size();
       }
 
       inline
       Scalar getWeight(size_t i) const
       {
-        assert(i < m_points.size());
-        return m_points[i].weight;
+        assert(i < size());
+        return m_weights.coeff(i);
+      }
+
+      /**
+       * @brief Gets the weights of all the points.
+       */
+      inline
+      const Math::Vector& getWeights() const
+      {
+        return m_weights;
       }
 
       inline
       const Math::Vector& getPoint(size_t i) const
       {
-        assert(i < m_points.size());
-        return m_points[i].point;
+        assert(i < m_coordinates.size());
+        return m_coordinates[i];
+      }
+
+      /**
+       * @brief Gets the reference coordinates of all the points, one point
+       * per column.
+       */
+      inline
+      const Math::Matrix& getPoints() const
+      {
+        return m_points;
+      }
+
+      inline
+      const mfem::IntegrationRule& getHandle() const
+      {
+        assert(m_handle);
+        return *m_handle;
       }
 
     private:
-      std::vector<ValueType> m_points;
+      static size_t getDimension(Geometry::Type geometry);
+
+      const mfem::IntegrationRule* m_handle;
+      Math::Vector m_weights;
+      Math::Matrix m_points;
+
+      /// Columns of m_points, which are referred to by address by
+      /// Geometry::Point and by the finite element caches.
+      std::vector<Math::Vector> m_coordinates;
   };
 }
 
 #endif
-
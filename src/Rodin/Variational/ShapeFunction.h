@@ -355,14 +355,14 @@ namespace Rodin::Variational
       constexpr
       size_t getDOFs(const Geometry::Simplex& element) const
       {
-        return this->getFiniteElementSpace().getFiniteElement(element).getDOFs();
+        return this->getFiniteElementSpace().getDOFs(element).Size();
       }
 
       inline
       TensorBasis<Scalar> getTensorBasis(const Geometry::Point& p) const
       {
         const auto& fe = this->getFiniteElementSpace().getFiniteElement(p.getSimplex());
-        return fe.getBasis(p.getCoordinates(Geometry::Point::Coordinates::Reference));
+        return fe.getBasis(p.getReferenceCoordinates());
       }
 
       inline
@@ -447,14 +447,14 @@ namespace Rodin::Variational
       constexpr
       size_t getDOFs(const Geometry::Simplex& element) const
       {
-        return this->getFiniteElementSpace().getFiniteElement(element).getDOFs();
+        return this->getFiniteElementSpace().getDOFs(element).Size();
       }
 
       inline
       TensorBasis<Math::Vector> getTensorBasis(const Geometry::Point& p) const
       {
         const auto& fe = this->getFiniteElementSpace().getFiniteElement(p.getSimplex());
-        const Math::Vector& coords = p.getCoordinates(Geometry::Point::Coordinates::Reference);
+        const Math::Vector& coords = p.getReferenceCoordinates();
         return fe.getBasis(coords).transpose();
       }
 
@@ -0,0 +1,77 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <limits>
+#include <algorithm>
+
+#include "Rodin/Configure.h"
+
+#include "SubMeshTransfer.h"
+
+namespace Rodin::Variational
+{
+  SubMeshTransfer::SubMeshTransfer(
+      const FiniteElementSpaceBase& parent, const FiniteElementSpaceBase& child)
+    : m_parent(parent), m_child(child)
+  {
+    assert(child.getMesh().isSubMesh());
+    const auto& submesh =
+      static_cast<const Geometry::SubMesh<Context::Serial>&>(child.getMesh());
+    assert(submesh.getParent() == parent.getMesh());
+    assert(parent.getVectorDimension() == child.getVectorDimension());
+
+    const auto& s2pe = submesh.getElementMap();
+    const mfem::FiniteElementSpace& pfes = parent.getHandle();
+    const mfem::FiniteElementSpace& cfes = child.getHandle();
+
+    // The vertices of the SubMesh are numbered in the order of the parent,
+    // hence corresponding elements list their DOFs in the same order
+    constexpr Index none = std::numeric_limits<Index>::max();
+    m_c2p.assign(cfes.GetVSize(), none);
+    mfem::Array<int> pdofs, cdofs;
+    for (int i = 0; i < cfes.GetNE(); i++)
+    {
+      cfes.GetElementVDofs(i, cdofs);
+      pfes.GetElementVDofs(s2pe.getParent(i), pdofs);
+      assert(cdofs.Size() == pdofs.Size());
+      for (int k = 0; k < cdofs.Size(); k++)
+      {
+        assert(cdofs[k] >= 0 && pdofs[k] >= 0);
+        assert(m_c2p[cdofs[k]] == none || m_c2p[cdofs[k]] == static_cast<Index>(pdofs[k]));
+        m_c2p[cdofs[k]] = pdofs[k];
+      }
+    }
+    assert(std::find(m_c2p.begin(), m_c2p.end(), none) == m_c2p.end());
+    m_parentVersion.update(parent.getMesh());
+    m_childVersion.update(child.getMesh());
+  }
+
+  void SubMeshTransfer::restrict(const Math::Vector& parent, Math::Vector& child) const
+  {
+    assert(isCurrent());
+    assert(static_cast<size_t>(parent.size()) == getParent().getSize());
+    const size_t n = m_c2p.size();
+    child.resize(n);
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < n; i++)
+      child.coeffRef(i) = parent.coeff(m_c2p[i]);
+  }
+
+  void SubMeshTransfer::extend(const Math::Vector& child, Math::Vector& parent) const
+  {
+    assert(isCurrent());
+    assert(static_cast<size_t>(child.size()) == m_c2p.size());
+    assert(static_cast<size_t>(parent.size()) == getParent().getSize());
+    const size_t n = m_c2p.size();
+#ifdef RODIN_USE_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (size_t i = 0; i < n; i++)
+      parent.coeffRef(m_c2p[i]) = child.coeff(i);
+  }
+}
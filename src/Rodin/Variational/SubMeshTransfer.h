@@ -0,0 +1,141 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_VARIATIONAL_SUBMESHTRANSFER_H
+#define RODIN_VARIATIONAL_SUBMESHTRANSFER_H
+
+#include <vector>
+#include <functional>
+
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Geometry/SubMesh.h"
+
+#include "ForwardDecls.h"
+#include "FiniteElementSpace.h"
+
+namespace Rodin::Variational
+{
+  /**
+   * @brief Transfers grid functions between a finite element space on a
+   * SubMesh and the same finite element space on the parent mesh.
+   *
+   * On construction, each vector DOF of the SubMesh space is matched with
+   * the vector DOF of the parent space which it coincides with, using the
+   * element map of the SubMesh and the DOFs of each pair of corresponding
+   * elements. The restriction and the extension are then plain gathers and
+   * scatters of the grid function data.
+   *
+   * Both spaces must use the same finite element collection and vector
+   * dimension. The transfer must be built again once the topology of either
+   * mesh changed.
+   *
+   * @code{.cpp}
+   * SubMesh trimmed = Omega.trim(Exterior);
+   * H1 vh(Omega, d);
+   * H1 vhInt(trimmed, d);
+   * SubMeshTransfer transfer(vh, vhInt);
+   * // ...
+   * GridFunction u(vh);
+   * transfer.extend(uInt.getSolution(), u);
+   * @endcode
+   */
+  class SubMeshTransfer
+  {
+    public:
+      /**
+       * @brief Builds the transfer between the two spaces.
+       * @param[in] parent Finite element space on the parent mesh
+       * @param[in] child Finite element space on the SubMesh
+       */
+      SubMeshTransfer(const FiniteElementSpaceBase& parent, const FiniteElementSpaceBase& child);
+
+      SubMeshTransfer(const SubMeshTransfer&) = default;
+
+      SubMeshTransfer(SubMeshTransfer&&) = default;
+
+      /**
+       * @brief Gets the parent space.
+       */
+      const FiniteElementSpaceBase& getParent() const
+      {
+        return m_parent.get();
+      }
+
+      /**
+       * @brief Gets the SubMesh space.
+       */
+      const FiniteElementSpaceBase& getChild() const
+      {
+        return m_child.get();
+      }
+
+      /**
+       * @brief Gets the parent vector DOF of each vector DOF of the SubMesh
+       * space.
+       */
+      const std::vector<Index>& getDOFMap() const
+      {
+        return m_c2p;
+      }
+
+      /**
+       * @brief Determines if the transfer was built on the current topology
+       * of both meshes.
+       */
+      bool isCurrent() const
+      {
+        return m_parentVersion.isCurrent(getParent().getMesh())
+          && m_childVersion.isCurrent(getChild().getMesh());
+      }
+
+      /**
+       * @brief Restricts the data of a function of the parent space to the
+       * SubMesh space.
+       * @param[in] parent Data of the function of the parent space
+       * @param[out] child Data of the function of the SubMesh space
+       */
+      void restrict(const Math::Vector& parent, Math::Vector& child) const;
+
+      /**
+       * @brief Extends the data of a function of the SubMesh space to the
+       * parent space.
+       * @param[in] child Data of the function of the SubMesh space
+       * @param[in,out] parent Data of the function of the parent space.
+       * Only the DOFs which lie on the SubMesh are written, the other ones
+       * are left unchanged.
+       */
+      void extend(const Math::Vector& child, Math::Vector& parent) const;
+
+      template <class ParentDerived, class ParentFES, class ChildDerived, class ChildFES>
+      void restrict(
+          const GridFunctionBase<ParentDerived, ParentFES>& parent,
+          GridFunctionBase<ChildDerived, ChildFES>& child) const
+      {
+        assert(&parent.getFiniteElementSpace() == &getParent());
+        assert(&child.getFiniteElementSpace() == &getChild());
+        restrict(parent.getData(), child.getData());
+      }
+
+      template <class ChildDerived, class ChildFES, class ParentDerived, class ParentFES>
+      void extend(
+          const GridFunctionBase<ChildDerived, ChildFES>& child,
+          GridFunctionBase<ParentDerived, ParentFES>& parent) const
+      {
+        assert(&child.getFiniteElementSpace() == &getChild());
+        assert(&parent.getFiniteElementSpace() == &getParent());
+        extend(child.getData(), parent.getData());
+      }
+
+    private:
+      std::reference_wrapper<const FiniteElementSpaceBase> m_parent;
+      std::reference_wrapper<const FiniteElementSpaceBase> m_child;
+      std::vector<Index> m_c2p;
+      Geometry::MeshVersion m_parentVersion{ Geometry::MeshBase::Data::Topology };
+      Geometry::MeshVersion m_childVersion{ Geometry::MeshBase::Data::Topology };
+  };
+}
+
+#endif
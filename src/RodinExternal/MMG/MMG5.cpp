@@ -538,38 +538,61 @@ namespace Rodin::External::MMG
     bool isSurface = isSurfaceMesh(src);
     MMG::Mesh dst;
 
-    switch (src->dim) // Switch over space dimension
-    {
-      case 2:
+    // The entities are gathered in contiguous buffers which are then moved
+    // into the builder
+    const auto getVertices =
+      [&](size_t sdim)
       {
-        assert(!isSurface); // Surface embedded in 2D space not handled yet
-        auto build = dst.initialize(src->dim, src->dim);
-        // Add points
+        std::vector<Scalar> res(sdim * src->np);
         for (int i = 1; i <= src->np; i++)
-        {
-          build.vertex({ src->point[i].c[0], src->point[i].c[1] });
-          if (src->point[i].tag & MG_CRN)
-            dst.corner(i - 1);
-        }
-        // Add elements
+          std::copy_n(src->point[i].c, sdim, res.begin() + sdim * (i - 1));
+        return res;
+      };
+
+    const auto getTriangles =
+      [&]()
+      {
+        std::pair<std::vector<Index>, std::vector<Geometry::Attribute>> res;
+        auto& [vs, attrs] = res;
+        vs.resize(3 * src->nt);
+        attrs.resize(src->nt);
         for (int i = 1; i <= src->nt; i++)
         {
-          build.element(
-              Geometry::Type::Triangle,
-              { static_cast<size_t>(src->tria[i].v[0] - 1),
-                static_cast<size_t>(src->tria[i].v[1] - 1),
-                static_cast<size_t>(src->tria[i].v[2] - 1) },
-              src->tria[i].ref);
+          for (size_t k = 0; k < 3; k++)
+            vs[3 * (i - 1) + k] = src->tria[i].v[k] - 1;
+          attrs[i - 1] = src->tria[i].ref;
         }
-        // Add boundary
+        return res;
+      };
+
+    const auto getEdges =
+      [&]()
+      {
+        std::pair<std::vector<Index>, std::vector<Geometry::Attribute>> res;
+        auto& [vs, attrs] = res;
+        vs.resize(2 * src->na);
+        attrs.resize(src->na);
         for (int i = 1; i <= src->na; i++)
         {
-          build.face(
-              Geometry::Type::Segment,
-              { static_cast<size_t>(src->edge[i].a - 1),
-                static_cast<size_t>(src->edge[i].b - 1) },
-              src->edge[i].ref == 0 ? 128 : src->edge[i].ref);
+          vs[2 * (i - 1)] = src->edge[i].a - 1;
+          vs[2 * (i - 1) + 1] = src->edge[i].b - 1;
+          attrs[i - 1] = src->edge[i].ref == 0 ? 128 : src->edge[i].ref;
         }
+        return res;
+      };
+
+    switch (src->dim) // Switch over space dimension
+    {
+      case 2:
+      {
+        assert(!isSurface); // Surface embedded in 2D space not handled yet
+        auto build = dst.initialize(src->dim, src->dim);
+        build.vertices(getVertices(src->dim));
+        auto [triangles, triangleAttributes] = getTriangles();
+        build.elements(
+            Geometry::Type::Triangle, std::move(triangles), std::move(triangleAttributes));
+        auto [edges, edgeAttributes] = getEdges();
+        build.faces(Geometry::Type::Segment, std::move(edges), std::move(edgeAttributes));
         build.finalize();
         break;
       }
@@ -578,33 +601,14 @@ namespace Rodin::External::MMG
         if (isSurface)
         {
           auto build = dst.initialize(src->dim - 1, src->dim);
-          // Add points
-          for (int i = 1; i <= src->np; i++)
-          {
-            build.vertex({ src->point[i].c[0], src->point[i].c[1], src->point[i].c[2] });
-            if (src->point[i].tag & MG_CRN)
-              dst.corner(i - 1);
-          }
-
-          // Add elements
-          for (int i = 1; i <= src->nt; i++)
-          {
-            build.element(
-                Geometry::Type::Triangle,
-                { static_cast<size_t>(src->tria[i].v[0] - 1),
-                  static_cast<size_t>(src->tria[i].v[1] - 1),
-                  static_cast<size_t>(src->tria[i].v[2] - 1) },
-                src->tria[i].ref);
-          }
-
-          // Add boundary
+          build.vertices(getVertices(src->dim));
+          auto [triangles, triangleAttributes] = getTriangles();
+          build.elements(
+              Geometry::Type::Triangle, std::move(triangles), std::move(triangleAttributes));
+          auto [edges, edgeAttributes] = getEdges();
+          build.faces(Geometry::Type::Segment, std::move(edges), std::move(edgeAttributes));
           for (int i = 1; i <= src->na; i++)
           {
-            build.face(
-                Geometry::Type::Segment,
-                { static_cast<size_t>(src->edge[i].a - 1),
-                  static_cast<size_t>(src->edge[i].b - 1) },
-                src->edge[i].ref == 0 ? 128 : src->edge[i].ref);
             if (src->edge[i].tag & MG_GEO)
               dst.ridge(i - 1);
           }
@@ -613,13 +617,7 @@ namespace Rodin::External::MMG
         else
         {
           auto build = dst.initialize(src->dim, src->dim);
-          // Add points
-          for (int i = 1; i <= src->np; i++)
-          {
-            build.vertex({ src->point[i].c[0], src->point[i].c[1], src->point[i].c[2] });
-            if (src->point[i].tag & MG_CRN)
-              dst.corner(i - 1);
-          }
+          build.vertices(getVertices(src->dim));
 
           // Add edges
           for (int i = 1; i <= src->na; i++)
@@ -630,26 +628,21 @@ namespace Rodin::External::MMG
               dst.ridge(i - 1);
           }
 
-          for (int i = 1; i <= src->nt; i++)
-          {
-            build.face(
-              Geometry::Type::Triangle,
-              { static_cast<size_t>(src->tria[i].v[0] - 1),
-                static_cast<size_t>(src->tria[i].v[1] - 1),
-                static_cast<size_t>(src->tria[i].v[2] - 1) },
-              src->tria[i].ref);
-          }
+          auto [triangles, triangleAttributes] = getTriangles();
+          build.faces(
+              Geometry::Type::Triangle, std::move(triangles), std::move(triangleAttributes));
 
+          std::vector<Index> tetrahedra(4 * src->ne);
+          std::vector<Geometry::Attribute> tetrahedronAttributes(src->ne);
           for (int i = 1; i <= src->ne; i++)
           {
-            build.element(
-              Geometry::Type::Tetrahedron,
-              { static_cast<size_t>(src->tetra[i].v[0] - 1),
-                static_cast<size_t>(src->tetra[i].v[1] - 1),
-                static_cast<size_t>(src->tetra[i].v[2] - 1),
-                static_cast<size_t>(src->tetra[i].v[3] - 1) },
-                src->tetra[i].ref);
+            for (size_t k = 0; k < 4; k++)
+              tetrahedra[4 * (i - 1) + k] = src->tetra[i].v[k] - 1;
+            tetrahedronAttributes[i - 1] = src->tetra[i].ref;
           }
+          build.elements(
+              Geometry::Type::Tetrahedron,
+              std::move(tetrahedra), std::move(tetrahedronAttributes));
           build.finalize();
         }
         break;
@@ -659,6 +652,12 @@ namespace Rodin::External::MMG
         Alert::Exception("Unhandled case").raise();
       }
     }
+
+    for (int i = 1; i <= src->np; i++)
+    {
+      if (src->point[i].tag & MG_CRN)
+        dst.corner(i - 1);
+    }
     return dst;
   }
 
@@ -0,0 +1,115 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <benchmark/benchmark.h>
+
+#include <Rodin/Geometry.h>
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+
+namespace RodinBenchmark
+{
+  /**
+   * Triangulation of the unit square by a grid of n x n squares, stored
+   * like the arrays which MMG5::meshToRodin reads: the coordinates one
+   * vertex after the other, then the vertices and the reference of each
+   * triangle and boundary edge.
+   */
+  struct MeshBuilder : public benchmark::Fixture
+  {
+    public:
+      void SetUp(const benchmark::State& st)
+      {
+        const size_t n = st.range(0);
+        const Scalar h = 1.0 / n;
+        coordinates.clear();
+        for (size_t j = 0; j <= n; j++)
+        {
+          for (size_t i = 0; i <= n; i++)
+          {
+            coordinates.push_back(i * h);
+            coordinates.push_back(j * h);
+          }
+        }
+
+        const auto vertex = [&](size_t i, size_t j) { return j * (n + 1) + i; };
+        triangles.clear();
+        for (size_t j = 0; j < n; j++)
+        {
+          for (size_t i = 0; i < n; i++)
+          {
+            triangles.insert(triangles.end(),
+                { vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1) });
+            triangles.insert(triangles.end(),
+                { vertex(i, j), vertex(i + 1, j + 1), vertex(i, j + 1) });
+          }
+        }
+        triangleAttributes.assign(2 * n * n, 1);
+
+        edges.clear();
+        edgeAttributes.clear();
+        for (size_t k = 0; k < n; k++)
+        {
+          edges.insert(edges.end(), { vertex(k, 0), vertex(k + 1, 0) });
+          edges.insert(edges.end(), { vertex(n, k), vertex(n, k + 1) });
+          edges.insert(edges.end(), { vertex(k + 1, n), vertex(k, n) });
+          edges.insert(edges.end(), { vertex(0, k + 1), vertex(0, k) });
+          edgeAttributes.insert(edgeAttributes.end(), { 1, 2, 3, 4 });
+        }
+      }
+
+      void TearDown(const benchmark::State&)
+      {}
+
+      std::vector<Scalar> coordinates;
+      std::vector<Index> triangles;
+      std::vector<Attribute> triangleAttributes;
+      std::vector<Index> edges;
+      std::vector<Attribute> edgeAttributes;
+  };
+
+  BENCHMARK_DEFINE_F(MeshBuilder, PerEntity)
+  (benchmark::State& st)
+  {
+    for (auto _ : st)
+    {
+      Mesh<Context::Serial> mesh;
+      auto build = mesh.initialize(2, 2);
+      for (size_t i = 0; i < coordinates.size(); i += 2)
+        build.vertex({ coordinates[i], coordinates[i + 1] });
+      for (size_t i = 0; i < triangleAttributes.size(); i++)
+      {
+        build.element(Type::Triangle,
+            { triangles[3 * i], triangles[3 * i + 1], triangles[3 * i + 2] },
+            triangleAttributes[i]);
+      }
+      for (size_t i = 0; i < edgeAttributes.size(); i++)
+        build.face(Type::Segment, { edges[2 * i], edges[2 * i + 1] }, edgeAttributes[i]);
+      build.finalize();
+    }
+  }
+
+  BENCHMARK_DEFINE_F(MeshBuilder, Bulk)
+  (benchmark::State& st)
+  {
+    for (auto _ : st)
+    {
+      // The copies stand for the buffers which meshToRodin fills from the
+      // arrays of MMG before moving them into the builder
+      Mesh<Context::Serial> mesh;
+      mesh.initialize(2, 2)
+          .vertices(coordinates)
+          .elements(Type::Triangle, triangles, triangleAttributes)
+          .faces(Type::Segment, edges, edgeAttributes)
+          .finalize();
+    }
+  }
+
+  BENCHMARK_REGISTER_F(MeshBuilder, PerEntity)->Arg(64)->Arg(256)->Arg(1024);
+
+  BENCHMARK_REGISTER_F(MeshBuilder, Bulk)->Arg(64)->Arg(256)->Arg(1024);
+}
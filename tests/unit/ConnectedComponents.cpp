@@ -0,0 +1,105 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <deque>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <Rodin/Geometry.h>
+
+#include "Utility.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+
+namespace
+{
+  bool sameAttribute(const Element& el1, const Element& el2)
+  {
+    return el1.getAttribute() == el2.getAttribute();
+  }
+
+  /**
+   * Labels the components of elements of the same attribute with a
+   * breadth first search, starting from each unlabelled element in
+   * increasing order.
+   */
+  std::vector<Index> getReference(const Mesh<Context::Serial>& mesh)
+  {
+    const mfem::Mesh& handle = mesh.getHandle();
+    const size_t ne = handle.GetNE();
+    std::vector<std::vector<Index>> adjacent(ne);
+    for (int f = 0; f < handle.GetNumFaces(); f++)
+    {
+      int el1 = -1, el2 = -1;
+      handle.GetFaceElements(f, &el1, &el2);
+      if (el1 >= 0 && el2 >= 0
+          && handle.GetAttribute(el1) == handle.GetAttribute(el2))
+      {
+        adjacent[el1].push_back(el2);
+        adjacent[el2].push_back(el1);
+      }
+    }
+
+    constexpr Index none = std::numeric_limits<Index>::max();
+    std::vector<Index> res(ne, none);
+    Index count = 0;
+    for (Index i = 0; i < ne; i++)
+    {
+      if (res[i] != none)
+        continue;
+      std::deque<Index> queue = { i };
+      res[i] = count;
+      while (!queue.empty())
+      {
+        const Index j = queue.front();
+        queue.pop_front();
+        for (const Index k : adjacent[j])
+        {
+          if (res[k] == none)
+          {
+            res[k] = count;
+            queue.push_back(k);
+          }
+        }
+      }
+      count++;
+    }
+    return res;
+  }
+}
+
+TEST(ConnectedComponents, MatchesBreadthFirstSearch)
+{
+  const Mesh mesh = RodinTest::loadMesh("mfem/ccl-2d-example.mesh");
+  const auto labels = mesh.ccl(sameAttribute);
+  ASSERT_EQ(labels.size(), mesh.getCount(mesh.getDimension()));
+  EXPECT_EQ(labels, getReference(mesh));
+}
+
+TEST(ConnectedComponents, PartitionedMatchesSerial)
+{
+  const Mesh mesh = RodinTest::loadMesh("mfem/ccl-2d-example.mesh");
+  const auto labels = mesh.ccl(sameAttribute);
+  for (const auto method : { Partition::Method::CoordinateBisection, Partition::Method::Graph })
+  {
+    for (const size_t count : { 1, 2, 7, 64 })
+    {
+      const Partition partition(mesh, count, method);
+      EXPECT_EQ(mesh.ccl(sameAttribute, partition), labels)
+        << "Partition in " << count << " parts";
+    }
+  }
+}
+
+TEST(ConnectedComponents, RejectingPredicateIsolatesElements)
+{
+  const Mesh mesh = RodinTest::loadMesh("mfem/ccl-2d-example.mesh");
+  const auto labels = mesh.ccl([](const Element&, const Element&) { return false; });
+  for (size_t i = 0; i < labels.size(); i++)
+    EXPECT_EQ(labels[i], i);
+}
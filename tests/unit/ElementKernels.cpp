@@ -0,0 +1,90 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include <Rodin/Geometry.h>
+#include <Rodin/Variational.h>
+#include <Rodin/Variational/LinearElasticity.h>
+
+#include "Utility.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace
+{
+  constexpr Scalar tolerance = 1e-10;
+
+  void expectNear(const Math::Matrix& kernel, const Math::Matrix& quadrature)
+  {
+    ASSERT_EQ(kernel.rows(), quadrature.rows());
+    ASSERT_EQ(kernel.cols(), quadrature.cols());
+    EXPECT_LE((kernel - quadrature).norm(), tolerance * quadrature.norm());
+  }
+
+  /**
+   * Compares the closed-form element matrices, for the order given as
+   * parameter, with the ones computed by quadrature.
+   */
+  using ElementKernelsTest = ::testing::TestWithParam<size_t>;
+}
+
+TEST_P(ElementKernelsTest, Mass)
+{
+  const Mesh mesh = RodinTest::loadMesh("mfem/square-disc.mesh");
+  H1 vh(mesh, FiniteElementOrder(GetParam()));
+  TrialFunction u(vh);
+  TestFunction v(vh);
+  const Integral bfi(u, v);
+  for (auto it = mesh.getElement(); !it.end(); ++it)
+  {
+    ASSERT_TRUE(Internal::ElementKernels::isSupported(*it, vh));
+    expectNear(bfi.getMatrix(*it), Internal::integrate(bfi.getIntegrand(), *it));
+  }
+}
+
+TEST_P(ElementKernelsTest, Stiffness)
+{
+  const Mesh mesh = RodinTest::loadMesh("mfem/square-disc.mesh");
+  H1 vh(mesh, FiniteElementOrder(GetParam()));
+  TrialFunction u(vh);
+  TestFunction v(vh);
+  const Integral bfi(Grad(u), Grad(v));
+  for (auto it = mesh.getElement(); !it.end(); ++it)
+    expectNear(bfi.getMatrix(*it), Internal::integrate(bfi.getIntegrand(), *it));
+}
+
+TEST_P(ElementKernelsTest, ConstantDiffusion)
+{
+  const Mesh mesh = RodinTest::loadMesh("mfem/square-disc.mesh");
+  H1 vh(mesh, FiniteElementOrder(GetParam()));
+  TrialFunction u(vh);
+  TestFunction v(vh);
+  ScalarFunction f(3.0);
+  const Integral bfi(f * Grad(u), Grad(v));
+  for (auto it = mesh.getElement(); !it.end(); ++it)
+    expectNear(bfi.getMatrix(*it), Internal::integrate(bfi.getIntegrand(), *it));
+}
+
+TEST_P(ElementKernelsTest, Elasticity)
+{
+  const Mesh mesh = RodinTest::loadMesh("mfem/square-disc.mesh");
+  const Scalar lambda = 2.0, mu = 0.5;
+  H1 vh(mesh, mesh.getSpaceDimension(), FiniteElementOrder(GetParam()));
+  TrialFunction u(vh);
+  TestFunction v(vh);
+  // The coefficients given as functions are not known to be constant,
+  // hence the second integrator goes through the quadrature of mfem.
+  const auto bfi = LinearElasticityIntegral(u, v)(lambda, mu);
+  const auto reference = LinearElasticityIntegral(u, v)(
+      [&](const Point&) { return lambda; }, [&](const Point&) { return mu; });
+  for (auto it = mesh.getElement(); !it.end(); ++it)
+    expectNear(bfi.getMatrix(*it), reference.getMatrix(*it));
+}
+
+INSTANTIATE_TEST_SUITE_P(Lagrange, ElementKernelsTest, ::testing::Values(1, 2));
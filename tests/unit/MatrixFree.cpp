@@ -0,0 +1,74 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <string>
+#include <tuple>
+
+#include <gtest/gtest.h>
+
+#include <Rodin/Geometry.h>
+#include <Rodin/Variational.h>
+#include <Rodin/Variational/Assembly/MatrixFree.h>
+
+#include "Utility.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace
+{
+  using FES = H1<Scalar, Context::Serial>;
+
+  /**
+   * Compares the action of the matrix-free operator with the one of the
+   * matrix assembled by the Native policy, on a mesh and for an order given
+   * as parameters. The quadrature order is set on the integrators so that
+   * both policies integrate with the same rule, also on the elements which
+   * are not affine.
+   */
+  using MatrixFreeTest = ::testing::TestWithParam<std::tuple<std::string, size_t>>;
+}
+
+TEST_P(MatrixFreeTest, ActionMatchesNative)
+{
+  const auto& [meshfile, k] = GetParam();
+  Mesh mesh = RodinTest::loadMesh(meshfile);
+  FES vh(mesh, FiniteElementOrder(k));
+  TrialFunction u(vh);
+  TestFunction v(vh);
+  const size_t order = 2 * k + 2;
+
+  Integral mass(u, v);
+  mass.setQuadratureOrder(order);
+  Integral stiffness(Grad(u), Grad(v));
+  stiffness.setQuadratureOrder(order);
+
+  BilinearForm native(u, v);
+  native.add(mass).add(stiffness);
+  native.assemble();
+
+  BilinearForm<FES, FES, Context::Serial, mfem::Operator> mf(u, v);
+  mf.setAssembly(Assembly::MatrixFree<BilinearFormBase<mfem::Operator>>());
+  mf.add(mass).add(stiffness);
+  mf.assemble();
+
+  // Both integrators are applied without forming the matrix
+  ASSERT_TRUE(Internal::MatrixFreeOperator::isSupported(vh));
+  EXPECT_EQ(dynamic_cast<const mfem::SparseMatrix*>(&mf.getOperator()), nullptr);
+
+  mfem::Vector x(vh.getSize()), y(vh.getSize()), z(vh.getSize());
+  x.Randomize(1);
+  native.getOperator().Mult(x, y);
+  mf.getOperator().Mult(x, z);
+  z -= y;
+  EXPECT_LE(z.Normlinf(), 1e-10 * y.Normlinf());
+}
+
+INSTANTIATE_TEST_SUITE_P(Meshes, MatrixFreeTest,
+    ::testing::Combine(
+      ::testing::Values("mfem/square-disc.mesh", "mfem/StarSquare.mfem.mesh"),
+      ::testing::Values(1, 2, 3)));
@@ -0,0 +1,110 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <Rodin/Configure.h>
+#include <Rodin/Geometry.h>
+#include <Rodin/Variational.h>
+#include <Rodin/Variational/Assembly/OpenMP.h>
+
+#include "Utility.h"
+
+#ifdef RODIN_USE_OPENMP
+
+#include <omp.h>
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace
+{
+  /**
+   * Blocks of the OpenMP policy, small enough for the traversal to span
+   * several of them.
+   */
+  constexpr const size_t blockSize = 64;
+
+  /**
+   * Assembles the same forms with the Native and OpenMP policies, with the
+   * number of threads given as parameter.
+   */
+  using OpenMPAssemblyTest = ::testing::TestWithParam<int>;
+}
+
+TEST_P(OpenMPAssemblyTest, BilinearFormIsBitwiseIdentical)
+{
+  omp_set_num_threads(GetParam());
+  Mesh mesh = RodinTest::loadMesh("mfem/elasticity-example.mesh");
+  H1 vh(mesh, FiniteElementOrder(2));
+  TrialFunction u(vh);
+  TestFunction v(vh);
+  ScalarFunction f([](const Point& p) { return 1.0 + p.x() * p.y(); });
+
+  Integral stiffness(Grad(u), Grad(v));
+  Integral mass(u, v);
+  mass.over(2);
+  BoundaryIntegral robin(u, v);
+  robin.over({ 1, 3 });
+  Integral diffusion(f * Grad(u), Grad(v));
+
+  BilinearForm native(u, v);
+  native.setAssembly(Assembly::Native<BilinearFormBase<mfem::SparseMatrix>>());
+  BilinearForm openmp(u, v);
+  openmp.setAssembly(Assembly::OpenMP<BilinearFormBase<mfem::SparseMatrix>>(blockSize));
+  for (auto* form : { &native, &openmp })
+  {
+    form->add(stiffness).add(mass).add(robin).add(diffusion);
+    form->assemble();
+    form->getOperator().Finalize();
+  }
+
+  const auto& a = native.getOperator();
+  const auto& b = openmp.getOperator();
+  ASSERT_EQ(a.Height(), b.Height());
+  ASSERT_EQ(a.NumNonZeroElems(), b.NumNonZeroElems());
+  EXPECT_TRUE(std::equal(a.GetI(), a.GetI() + a.Height() + 1, b.GetI()));
+  EXPECT_TRUE(std::equal(a.GetJ(), a.GetJ() + a.NumNonZeroElems(), b.GetJ()));
+  EXPECT_TRUE(std::equal(a.GetData(), a.GetData() + a.NumNonZeroElems(), b.GetData()));
+}
+
+TEST_P(OpenMPAssemblyTest, LinearFormIsBitwiseIdentical)
+{
+  omp_set_num_threads(GetParam());
+  Mesh mesh = RodinTest::loadMesh("mfem/elasticity-example.mesh");
+  H1 vh(mesh, FiniteElementOrder(2));
+  TestFunction v(vh);
+  ScalarFunction f([](const Point& p) { return 1.0 + p.x() * p.y(); });
+  ScalarFunction g(2.0);
+
+  Integral source(f, v);
+  Integral restricted(g, v);
+  restricted.over(1);
+  BoundaryIntegral neumann(g, v);
+  neumann.over(4);
+
+  LinearForm native(v);
+  native.setAssembly(Assembly::Native<LinearFormBase<mfem::Vector>>());
+  LinearForm openmp(v);
+  openmp.setAssembly(Assembly::OpenMP<LinearFormBase<mfem::Vector>>(blockSize));
+  for (auto* form : { &native, &openmp })
+  {
+    form->add(source).add(restricted).add(neumann);
+    form->assemble();
+  }
+
+  const auto& a = native.getVector();
+  const auto& b = openmp.getVector();
+  ASSERT_EQ(a.Size(), b.Size());
+  EXPECT_TRUE(std::equal(a.GetData(), a.GetData() + a.Size(), b.GetData()));
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads, OpenMPAssemblyTest, ::testing::Values(1, 2, 3, 8));
+
+#endif
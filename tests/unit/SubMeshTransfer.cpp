@@ -0,0 +1,82 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include <Rodin/Geometry.h>
+#include <Rodin/Variational.h>
+
+#include "Utility.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace
+{
+  Scalar f(const Point& p)
+  {
+    return p.x() * p.x() - 2.0 * p.y() + 1.0;
+  }
+
+  /**
+   * Transfers grid functions between the whole mesh and the SubMesh of
+   * the elements of attribute 1, for the order given as parameter.
+   */
+  using SubMeshTransferTest = ::testing::TestWithParam<size_t>;
+}
+
+TEST_P(SubMeshTransferTest, RestrictionMatchesProjection)
+{
+  Mesh mesh = RodinTest::loadMesh("mfem/elasticity-example.mesh");
+  SubMesh submesh = mesh.keep(1);
+  H1 vh(mesh, FiniteElementOrder(GetParam()));
+  H1 sh(submesh, FiniteElementOrder(GetParam()));
+  SubMeshTransfer transfer(vh, sh);
+  ASSERT_TRUE(transfer.isCurrent());
+
+  GridFunction u(vh);
+  u.project(f);
+  GridFunction uc(sh);
+  transfer.restrict(u, uc);
+
+  // The nodes of both spaces coincide on the SubMesh
+  GridFunction expected(sh);
+  expected.project(f);
+  EXPECT_LE((uc.getData() - expected.getData()).lpNorm<Eigen::Infinity>(), 1e-12);
+}
+
+TEST_P(SubMeshTransferTest, RoundTrip)
+{
+  Mesh mesh = RodinTest::loadMesh("mfem/elasticity-example.mesh");
+  SubMesh submesh = mesh.keep(1);
+  H1 vh(mesh, FiniteElementOrder(GetParam()));
+  H1 sh(submesh, FiniteElementOrder(GetParam()));
+  SubMeshTransfer transfer(vh, sh);
+
+  GridFunction uc(sh);
+  uc.project(f);
+  GridFunction u(vh);
+  u = -1.0;
+  transfer.extend(uc, u);
+
+  // Only the DOFs of the SubMesh are written
+  const auto& map = transfer.getDOFMap();
+  std::vector<bool> written(vh.getSize(), false);
+  for (const Index dof : map)
+    written[dof] = true;
+  for (size_t i = 0; i < written.size(); i++)
+  {
+    if (!written[i])
+      EXPECT_EQ(u.getData().coeff(i), -1.0);
+  }
+
+  GridFunction vc(sh);
+  transfer.restrict(u, vc);
+  EXPECT_EQ(vc.getData(), uc.getData());
+}
+
+INSTANTIATE_TEST_SUITE_P(Lagrange, SubMeshTransferTest, ::testing::Values(1, 2, 3));
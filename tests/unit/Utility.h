@@ -0,0 +1,32 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_TESTS_UNIT_UTILITY_H
+#define RODIN_TESTS_UNIT_UTILITY_H
+
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include <Rodin/Configure.h>
+#include <Rodin/Geometry.h>
+
+namespace RodinTest
+{
+  /**
+   * @brief Loads a mesh from the resources directory.
+   * @param[in] filename Path of the mesh, relative to RODIN_RESOURCES_DIR
+   */
+  inline
+  Rodin::Geometry::Mesh<Rodin::Context::Serial> loadMesh(const std::string& filename)
+  {
+    boost::filesystem::path meshfile(RODIN_RESOURCES_DIR);
+    meshfile.append(filename);
+    return Rodin::Geometry::Mesh<Rodin::Context::Serial>(meshfile);
+  }
+}
+
+#endif